@@ -64,10 +64,15 @@ namespace GameConstants {
         constexpr float SPAWN_MARGIN = 100.0f;
         constexpr float HEALTH_BAR_HEIGHT = 3.0f;
         constexpr float HEALTH_BAR_Y_OFFSET = -10.0f;
+        // Розштовхування натовпу
+        constexpr float SEPARATION_CELL_SIZE = 40.0f;
+        constexpr int SEPARATION_MAX_NEIGHBORS = 8;
+        constexpr float SEPARATION_RELAXATION = 0.5f;
+        constexpr float SEPARATION_MAX_SPEED = 240.0f;
         
         namespace ColoradoBeetle {
             constexpr float HEALTH = 30.0f;
-            constexpr float SPEED = 50.0f;
+            constexpr float SPEED = 150.0f;
             constexpr float DAMAGE = 10.0f;
             constexpr float RADIUS = 15.0f;
             constexpr float ATTACK_INTERVAL = 1.0f;
@@ -80,14 +85,57 @@ namespace GameConstants {
             constexpr float BODY_RADIUS = 3.0f;
         }
         
-        // Готовність для нових ворогів
+        // Попелиця: слабка, дрібна і швидко набирається в зграї
         namespace Aphid {
             constexpr float HEALTH = 10.0f;
             constexpr float SPEED = 80.0f;
             constexpr float DAMAGE = 5.0f;
             constexpr float RADIUS = 8.0f;
+            constexpr float ATTACK_INTERVAL = 0.5f;
             constexpr Color COLOR = GREEN;
         }
+
+        // Дротяник: повзе до цілі зигзагом
+        namespace Wireworm {
+            constexpr float HEALTH = 20.0f;
+            constexpr float SPEED = 110.0f;
+            constexpr float DAMAGE = 8.0f;
+            constexpr float RADIUS = 10.0f;
+            constexpr float ATTACK_INTERVAL = 1.0f;
+            constexpr Color COLOR = GOLD;
+            constexpr float ZIGZAG_AMPLITUDE = 0.8f;   // Бічна швидкість відносно SPEED
+            constexpr float ZIGZAG_FREQUENCY = 4.0f;   // рад/с
+        }
+
+        // Капустянка: повільно підкрадається і час від часу робить ривок
+        namespace MoleCricket {
+            constexpr float HEALTH = 45.0f;
+            constexpr float SPEED = 70.0f;
+            constexpr float DAMAGE = 15.0f;
+            constexpr float RADIUS = 18.0f;
+            constexpr float ATTACK_INTERVAL = 2.5f;   // Пауза між ривками
+            constexpr Color COLOR = BROWN;
+            constexpr float DASH_MULTIPLIER = 4.0f;
+            constexpr float DASH_DURATION = 0.4f;
+        }
+
+        // Совка: повільна й живуча, поблизу цілі кидається в атаку
+        namespace Cutworm {
+            constexpr float HEALTH = 70.0f;
+            constexpr float SPEED = 50.0f;
+            constexpr float DAMAGE = 20.0f;
+            constexpr float RADIUS = 16.0f;
+            constexpr float ATTACK_INTERVAL = 1.5f;
+            constexpr Color COLOR = GRAY;
+            constexpr float AMBUSH_RADIUS = 200.0f;
+            constexpr float AMBUSH_MULTIPLIER = 2.5f;
+        }
+
+        // З якого рівня складності тип з'являється при спавні
+        constexpr int APHID_LEVEL = 1;
+        constexpr int WIREWORM_LEVEL = 2;
+        constexpr int MOLE_CRICKET_LEVEL = 3;
+        constexpr int CUTWORM_LEVEL = 4;
     }
     
     // ===========================================
@@ -120,6 +168,8 @@ namespace GameConstants {
             constexpr float BACKGROUND_ALPHA = 0.7f;
             constexpr int PLAYER_DOT_RADIUS = 3;
             constexpr int ENEMY_DOT_RADIUS = 1;
+            constexpr float UPDATE_RATE = 10.0f;      // Гц, перебудова теплокарти
+            constexpr int DENSITY_RESOLUTION = 64;    // Клітинок теплокарти по ширині світу
         }
         
         namespace Colors {
@@ -156,6 +206,9 @@ namespace GameConstants {
         constexpr int DANGER_ZONE_SIZE = 20;
         constexpr float DANGER_ZONE_LINE_WIDTH = 4.0f;
         constexpr float GRID_ALPHA = 0.1f;
+        // Індекси статичних шарів, кешованих у RenderSystem
+        constexpr int BACKGROUND_LAYER = -100;
+        constexpr int BOUNDS_LAYER = 100;
     }
     
     // ===========================================
@@ -185,6 +238,14 @@ namespace GameConstants {
         constexpr int TARGET_FPS = 60;
         constexpr int MAX_ENEMIES_ABSOLUTE = 200;  // Абсолютний ліміт для performance
         constexpr int MAX_BULLETS_ABSOLUTE = 500;
+        constexpr float ENEMY_GRID_CELL_SIZE = 64.f;  // Клітинка сітки ворогів для перевірки влучань куль
+        constexpr float FLOW_FIELD_CELL_SIZE = 32.f;  // Клітинка поля напрямків до гравця
+        // Рівні симуляції ворогів: відстань від краю видимої області; пари порогів дають гістерезис
+        constexpr int LOD_NEARBY_INTERVAL = 4;  // Невидимі крокують раз на стільки кадрів, щокадру — свій кошик
+        constexpr float LOD_VISIBLE_ENTER_MARGIN = 96.f;
+        constexpr float LOD_VISIBLE_EXIT_MARGIN = 192.f;
+        constexpr float LOD_DISTANT_EXIT_DISTANCE = 320.f;
+        constexpr float LOD_DISTANT_ENTER_DISTANCE = 416.f;
         constexpr float CLEANUP_INTERVAL = 0.1f;  // Як часто чистити мертві об'єкти
     }
 }
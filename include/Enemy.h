@@ -1,13 +1,9 @@
 #pragma once
 #include <raylib.h>
 
-enum class EnemyType {
-  ColoradoBeetle,
-  Aphid,
-  Wireworm,
-  MoleCricket,
-  Cutworm
-};
+#include "components/Chaser.h"
+
+class RenderCommandBuffer;
 
 class Enemy {
 
@@ -25,8 +21,8 @@ public:
 
   virtual ~Enemy() = default;
 
-  virtual void update(const Vector2 &targetPos) = 0;
-  virtual void draw() const = 0;
+  virtual void update(const Vector2 &targetPos, float delta_time) = 0;
+  virtual void draw(RenderCommandBuffer &commands) const = 0;
   virtual EnemyType get_type() const = 0;
 
   virtual void take_damage(float damage);
@@ -4,6 +4,19 @@
 
 #include "Enemy.h"
 
+class Entity;
+class EntityManager;
+
+// Параметри типу ворога — спільні для класів Enemy і ECS-сутностей
+struct EnemyStats {
+  float health;
+  float speed;
+  float damage;
+  float radius;
+  float attack_interval;
+  Color color;
+};
+
 class EnemyFactory {
 private:
   static std::random_device rd_;
@@ -14,7 +27,17 @@ public:
 
   static std::unique_ptr<Enemy> create_random_enemy_for_level(int level, Vector2 position);
 
-private:
+  // Сутність з Transform, Collider, Sprite і Chaser; реєстрація в системах — на викликачеві.
+  // Здоров'я і стан руху сутність отримує від EnemySystem при реєстрації.
+  // nullptr, якщо тип ще не реалізований
+  static Entity* create_enemy_entity(EntityManager &manager, EnemyType type, Vector2 position);
+  // Порожній набір компонентів ворога — для слотів пулу, які потім заповнює reset_enemy_entity
+  static void add_enemy_components(Entity *entity);
+  // Повертає сутність з add_enemy_components до свіжого стану ворога типу type; false — тип не реалізований
+  static bool reset_enemy_entity(Entity *entity, EnemyType type, Vector2 position);
+
+  static const EnemyStats* get_stats(EnemyType type);
 
+  // Випадковий тип серед відкритих на цьому рівні складності
   static EnemyType get_random_type_for_level(int level);
-};
\ No newline at end of file
+};
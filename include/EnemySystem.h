@@ -0,0 +1,133 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "raylib.h"
+#include "Constants.h"
+#include "components/Chaser.h"
+#include "systems/CrowdSeparation.h"
+
+class Entity;
+class FlowField;
+class ThreadPool;
+
+// Рівень деталізації симуляції ворога залежно від відстані до видимої області
+enum class SimulationLod : std::uint8_t {
+  VISIBLE,  // Щокадру, з розштовхуванням
+  NEARBY,   // Раз на LOD_NEARBY_INTERVAL кадрів з часом, накопиченим від власного попереднього кроку
+  DISTANT,  // Там само, але лише рух по прямій без поведінки типу
+};
+
+// Вороги, згруповані за типом у SoA-пачки. Кожен тип має власне невіртуальне ядро, що проходить
+// всю пачку одним циклом; сутності лишаються лише дескрипторами для колізій і рендера —
+// після кроку система записує їм позицію і швидкість у Transform
+class EnemySystem {
+public:
+  // Невидимі рівні розбиті на кошики за id сутності; щокадру крокує по одному кошику кожного,
+  // тож кожен невидимий агент крокує рівно раз на LOD_NEARBY_INTERVAL кадрів
+  static constexpr size_t LOD_BUCKET_COUNT = GameConstants::Performance::LOD_NEARBY_INTERVAL;
+  // Групи агентів у пачці: VISIBLE, кошики NEARBY, кошики DISTANT
+  static constexpr size_t LOD_GROUP_COUNT = 1 + 2 * LOD_BUCKET_COUNT;
+  static constexpr size_t VISIBLE_GROUP = 0;
+  static constexpr size_t nearby_group(const size_t bucket) { return 1 + bucket; }
+  static constexpr size_t distant_group(const size_t bucket) { return 1 + LOD_BUCKET_COUNT + bucket; }
+
+  struct Batch {
+    std::vector<float> position_x;
+    std::vector<float> position_y;
+    std::vector<float> velocity_x;
+    std::vector<float> velocity_y;
+    // Поточна швидкість агента: базова типу або змінена поведінкою (ривок, засідка)
+    std::vector<float> speed;
+    // Проміжна точка з поля напрямків; використовується лише в кадрах, коли use_waypoints
+    std::vector<float> waypoint_x;
+    std::vector<float> waypoint_y;
+    bool use_waypoints = false;
+    std::vector<int> health;
+    std::vector<float> cooldown;
+    // Фаза поведінки типу: зигзаг дротяника, залишок ривка капустянки
+    std::vector<float> phase;
+    std::vector<Entity*> entities;
+    // Час симуляції останнього кроку агента і крок поточного кадру від нього — невидимі крокують рідше,
+    // а агент, що змінив рівень чи з'явився посеред інтервалу, отримує рівно свій час
+    std::vector<double> last_step;
+    std::vector<float> step_time;
+    // Агенти впорядковані за групою, group_begin[g] — початок групи g: [0, nearby_begin()) — VISIBLE,
+    // [nearby_begin(), distant_begin()) — NEARBY, решта — DISTANT. Кожну групу ядра проходять
+    // одним суцільним діапазоном
+    std::vector<std::uint8_t> group;
+    std::array<size_t, LOD_GROUP_COUNT> group_begin{};
+
+    size_t size() const { return entities.size(); }
+    size_t group_end(const size_t g) const { return g + 1 < LOD_GROUP_COUNT ? group_begin[g + 1] : size(); }
+    size_t nearby_begin() const { return group_begin[nearby_group(0)]; }
+    size_t distant_begin() const { return group_begin[distant_group(0)]; }
+  };
+
+  struct LodCounts {
+    size_t visible = 0;
+    size_t nearby = 0;
+    size_t distant = 0;
+  };
+
+private:
+  std::array<Batch, ENEMY_TYPE_COUNT> batches_;
+  const FlowField *flow_field_ = nullptr;
+  // Розштовхування всіх типів разом після кроку ядер — інакше рій збивається в одну точку на гравці
+  CrowdSeparation separation_{
+    Rectangle{0.f, 0.f, static_cast<float>(GameConstants::WORLD_WIDTH), static_cast<float>(GameConstants::WORLD_HEIGHT)},
+    CrowdSeparation::Settings{
+      .cell_size = GameConstants::Enemy::SEPARATION_CELL_SIZE,
+      .max_neighbors = static_cast<size_t>(GameConstants::Enemy::SEPARATION_MAX_NEIGHBORS),
+      .relaxation = GameConstants::Enemy::SEPARATION_RELAXATION,
+      .max_speed = GameConstants::Enemy::SEPARATION_MAX_SPEED}};
+  // Видима область останнього update — за нею новий ворог одразу отримує свій рівень
+  Rectangle view_bounds_{};
+  size_t frame_ = 0;
+  // Час симуляції від першого update; з ним порівнюється last_step агентів
+  double clock_ = 0.0;
+  // Переходи між рівнями поточного кадру — сутність і її нова група
+  std::vector<std::pair<Entity*, size_t>> lod_moves_;
+
+public:
+  // Сутність з Chaser і Transform потрапляє в пачку свого типу зі свіжим здоров'ям
+  void register_entity(Entity *entity);
+  void unregister_entity(const Entity *entity);
+  void clear_entities();
+  // Резерв на кожну пачку: тип може займати весь пул
+  void reserve(size_t capacity_per_type);
+
+  // Поле напрямків до тієї ж цілі, що й target в update; nullptr — завжди по прямій
+  void set_flow_field(const FlowField *flow_field) { flow_field_ = flow_field; }
+  // Пул для розштовхування великих роїв; nullptr — у потоці симуляції
+  void set_thread_pool(ThreadPool *pool) { separation_.set_thread_pool(pool); }
+
+  // Ціна кадру залежить від кількості видимих ворогів: з невидимих щокадру крокує один кошик NEARBY
+  // і один DISTANT. Видимі й ті, хто крокував, переглядаються за view_bounds
+  void update(float delta_time, Vector2 target, Rectangle view_bounds);
+
+  // true, якщо саме цей удар убив ворога
+  bool apply_damage(const Entity *entity, int damage);
+  void kill(const Entity *entity);
+  [[nodiscard]] bool is_alive(const Entity *entity) const;
+  [[nodiscard]] float get_health_percentage(const Entity *entity) const;
+
+  [[nodiscard]] const Batch& get_batch(EnemyType type) const { return batches_[static_cast<size_t>(type)]; }
+  [[nodiscard]] size_t get_enemy_count() const;
+  [[nodiscard]] LodCounts get_lod_counts() const;
+
+private:
+  Batch* find_batch(const Entity *entity, std::uint32_t &index);
+  const Batch* find_batch(const Entity *entity, std::uint32_t &index) const;
+
+  // Обмін двох агентів пачки з оновленням batch_index їхніх сутностей
+  static void swap_agents(Batch &batch, size_t a, size_t b);
+  // Переносить агента на межу сусідньої групи, доки той не опиниться в group; повертає новий індекс
+  static size_t move_to_group(Batch &batch, size_t index, size_t group);
+  void reclassify(Batch &batch, size_t bucket);
+
+  void separate(float delta_time);
+  static void publish(const Batch &batch, size_t begin, size_t end);
+};
@@ -5,12 +5,25 @@
 #include <string>
 
 #include "EnemyFactory.h"
+#include "EnemySystem.h"
 #include "PlayerCamera.h"
 #include "Constants.h"
-
-class Player;
-class Enemy;
-class Bullet;
+#include "core/DenseGrid.h"
+#include "core/EntityManager.h"
+#include "core/EntityPool.h"
+#include "core/InputSnapshot.h"
+#include "systems/CollisionSystem.h"
+#include "systems/FlowField.h"
+#include "systems/GlyphAtlas.h"
+#include "systems/HudText.h"
+#include "systems/RenderCommandBuffer.h"
+#include "systems/TransformSystem.h"
+
+class PrimitiveRenderer;
+class RenderSystem;
+class Minimap;
+class SimulationThread;
+class ThreadPool;
 
 class Game {
 public:
@@ -28,16 +41,25 @@ public:
 private:
   // Методи життєвого циклу
   void init();
-  void update();
+  // Атлас гліфів з символів перекладів; без шрифту з кирилицею — транслітеровані каталоги
+  void init_font();
+  // Потік симуляції: крок гри і запис команд кадру в задній буфер
+  void simulate_frame(const InputSnapshot &input);
+  void update(const InputSnapshot &input);
+  void record_frame(RenderCommandBuffer &commands, const InputSnapshot &input);
+  // Головний потік, поки симуляція стоїть: обмін буферів і вивантаження текстур
+  void sync_frame();
   void draw() const;
 
   void draw_world_background() const;
 
-  void draw_game_objects() const;
-  void draw_state_messages() const;
-  void draw_ui() const;
-  void draw_minimap() const;
+  void record_game_objects(RenderCommandBuffer &commands) const;
+  void record_state_messages(RenderCommandBuffer &commands);
+  void record_ui(RenderCommandBuffer &commands, const InputSnapshot &input);
+  void record_minimap(RenderCommandBuffer &commands) const;
+  void update_minimap(float dt);
   void draw_world_bounds() const;
+  void init_static_layers();
   bool is_position_in_camera(Vector2 position, float margin = 100.f) const;
   static void toggle_language();
 
@@ -46,16 +68,29 @@ private:
   void unload();
 
   // Ігрова логіка
+  void create_player();
+  // Слоти ворогів і куль створюються один раз; у бою сутності лише беруться з пулів і повертаються
+  void init_pools();
   void spawn_enemy();
   void spawn_bullet();
-  void handle_input();
+  void handle_input(const InputSnapshot &input);
+  void update_player(const InputSnapshot &input);
+  void update_enemies(float delta_time);
+  void update_bullets(float delta_time);
+  void on_collision(const CollisionInfo &info);
   void check_collisions();
   void cleanup_dead_objects();
-  void update_timers();
+  // Виводить сутність із систем; пул викликає це і для витіснених політикою
+  void unregister_entity(Entity *entity);
+  void destroy_entity(Entity *entity);
+  void clear_entities();
+  void update_timers(float delta_time);
 
   void restart_game();
 
-  [[nodiscard]] Enemy* find_nearest_enemy() const;
+  [[nodiscard]] bool is_player_alive() const;
+  [[nodiscard]] Vector2 get_player_position() const;
+  [[nodiscard]] Entity* find_nearest_enemy() const;
   [[nodiscard]] Vector2 get_random_spawn_position() const;
 
   void update_difficulty();
@@ -63,18 +98,92 @@ private:
 
 #ifdef _DEBUG
   bool show_debug_info_ = true;
-  void draw_debug_info() const;
+  void record_debug_info(RenderCommandBuffer &commands, const InputSnapshot &input);
 #endif
 
   // Основні об'єкти гри
   std::string title_;
   GameState state_ = GameState::PLAYING;
 
-  // Smart pointers замість raw
-  std::unique_ptr<Player> player_;
-  std::vector<std::unique_ptr<Enemy>> enemies_;
-  std::vector<std::unique_ptr<Bullet>> bullets_;
+  // Сутності гри належать менеджеру; системи й списки нижче тримають лише вказівники
+  EntityManager entity_manager_;
+  TransformSystem transform_system_;
+  CollisionSystem collision_system_;
+  EnemySystem enemy_system_;
+  Entity *player_ = nullptr;
+  // Живі вороги й кулі в порядку появи — від нього залежить, кого куля влучить першою.
+  // Місткість — абсолютні ліміти Performance; при переповненні вороги витісняють найдальшого від гравця,
+  // а кулі — найстарішу
+  EntityPool enemy_pool_{PoolOverflowPolicy::RECYCLE_FARTHEST};
+  EntityPool bullet_pool_{PoolOverflowPolicy::DROP_OLDEST};
+  // Позиції живих ворогів за індексом у пулі і сітка над ними — перебудовуються в check_collisions щокадру
+  std::vector<Vector2> enemy_positions_;
+  DenseGrid enemy_grid_{
+    Rectangle{0.f, 0.f, static_cast<float>(GameConstants::WORLD_WIDTH), static_cast<float>(GameConstants::WORLD_HEIGHT)},
+    GameConstants::Performance::ENEMY_GRID_CELL_SIZE};
+  // Спільне поле шляху до гравця; перераховується, лише коли гравець переходить у нову клітинку
+  FlowField flow_field_{
+    Rectangle{0.f, 0.f, static_cast<float>(GameConstants::WORLD_WIDTH), static_cast<float>(GameConstants::WORLD_HEIGHT)},
+    GameConstants::Performance::FLOW_FIELD_CELL_SIZE};
+  // Гравець отримує не більше одного удару за кадр, як і до переходу на CollisionSystem
+  bool player_hit_this_frame_ = false;
+
   std::unique_ptr<PlayerCamera> camera_;
+  std::unique_ptr<PrimitiveRenderer> primitive_renderer_;
+  std::unique_ptr<RenderSystem> render_system_;
+  std::unique_ptr<Minimap> minimap_;
+  GlyphAtlas glyph_atlas_;
+
+  // Рядки HUD з кешованою розкладкою: перерозкладаються лише при зміні значень або мови
+  struct Hud {
+    static constexpr float MARGIN = 10.f;
+    static constexpr float LINE_HEIGHT = 25.f;
+    static constexpr float CENTER_X = GameConstants::SCREEN_WIDTH / 2.f;
+    static constexpr float CENTER_Y = GameConstants::SCREEN_HEIGHT / 2.f;
+    static constexpr float HINT_Y = GameConstants::SCREEN_HEIGHT;
+
+    HudText<const char*, int> health{"%s: %d", {MARGIN, MARGIN}, 20, WHITE};
+    HudText<const char*, int> killed{"%s: %d", {MARGIN, MARGIN + LINE_HEIGHT}, 20, WHITE};
+    HudText<const char*, float, const char*> time{"%s: %.1f %s", {MARGIN, MARGIN + LINE_HEIGHT * 2}, 20, WHITE};
+    HudText<const char*, size_t> enemies{"%s: %zu", {MARGIN, MARGIN + LINE_HEIGHT * 3}, 20, WHITE};
+    HudText<const char*, size_t> bullets{"%s: %zu", {MARGIN, MARGIN + LINE_HEIGHT * 4}, 20, WHITE};
+
+    HudText<const char*> paused{"%s", {CENTER_X, CENTER_Y - 20}, 40, YELLOW, HudAlign::CENTER};
+    HudText<const char*> continue_hint{"%s", {CENTER_X, CENTER_Y + 30}, 20, WHITE, HudAlign::CENTER};
+    HudText<const char*> pause_language{"%s", {CENTER_X, CENTER_Y + 60}, 16, LIGHTGRAY, HudAlign::CENTER};
+
+    HudText<const char*> game_over{"%s", {CENTER_X, CENTER_Y - 25}, 50, RED, HudAlign::CENTER};
+    HudText<const char*> restart_hint{"%s", {CENTER_X, CENTER_Y + 40}, 25, WHITE, HudAlign::CENTER};
+    HudText<float, int> survival_stats{"", {CENTER_X, CENTER_Y + 80}, 20, LIGHTGRAY, HudAlign::CENTER};
+    HudText<const char*> game_over_language{"%s", {CENTER_X, CENTER_Y + 110}, 16, LIGHTGRAY, HudAlign::CENTER};
+
+    HudText<const char*> move_hint{"%s", {MARGIN, HINT_Y - 80}, 16, LIGHTGRAY};
+    HudText<const char*> shoot_hint{"%s", {MARGIN, HINT_Y - 60}, 16, LIGHTGRAY};
+    HudText<const char*> language_hint{"%s", {MARGIN, HINT_Y - 40}, 16, LIGHTGRAY};
+
+#ifdef _DEBUG
+    static constexpr float DEBUG_X = GameConstants::SCREEN_WIDTH - 250;
+    static constexpr float DEBUG_LINE_HEIGHT = 20.f;
+
+    HudText<const char*> debug_title{"%s", {DEBUG_X, 10}, 16, YELLOW};
+    HudText<const char*, int> fps{"%s: %d", {DEBUG_X, 10 + DEBUG_LINE_HEIGHT}, 16, GREEN};
+    HudText<const char*, float> delta{"%s: %.3f", {DEBUG_X, 10 + DEBUG_LINE_HEIGHT * 2}, 16, GREEN};
+    HudText<const char*, float> spawn_timer{"%s: %.2f", {DEBUG_X, 10 + DEBUG_LINE_HEIGHT * 3}, 16, WHITE};
+    HudText<const char*, float> shoot_timer{"%s: %.2f", {DEBUG_X, 10 + DEBUG_LINE_HEIGHT * 4}, 16, WHITE};
+    HudText<const char*, float> spawn_interval{"%s: %.2f", {DEBUG_X, 10 + DEBUG_LINE_HEIGHT * 5}, 16, ORANGE};
+    HudText<const char*, int> max_enemies{"%s: %d", {DEBUG_X, 10 + DEBUG_LINE_HEIGHT * 6}, 16, ORANGE};
+    HudText<const char*, size_t, size_t> visible_culled{"%s: %zu / %zu", {DEBUG_X, 10 + DEBUG_LINE_HEIGHT * 7}, 16, ORANGE};
+    HudText<const char*, float, float> player_pos{"%s: (%.0f, %.0f)", {DEBUG_X, 10 + DEBUG_LINE_HEIGHT * 8}, 16, BLUE};
+#endif
+  };
+  Hud hud_;
+
+  // Подвійний буфер команд: симуляція пише в задній, рендер читає передній
+  RenderCommandBuffer command_buffers_[2];
+  int front_buffer_ = 0;
+  std::unique_ptr<SimulationThread> simulation_;
+  // Робочі потоки для розштовхування великих роїв ворогів
+  std::unique_ptr<ThreadPool> crowd_workers_;
 
   // Таймери і лічильники з ініціалізацією
   float spawn_timer_ = 0.0f;
@@ -83,4 +192,8 @@ private:
   float shoot_interval_ = GameConstants::Gameplay::DEFAULT_SHOOT_INTERVAL;
   int kill_count_ = 0;
   float game_time_ = 0.0f;
+
+  // Статистика відсікання за камерою, рахується під час запису кадру
+  mutable size_t visible_objects_ = 0;
+  mutable size_t culled_objects_ = 0;
 };
@@ -0,0 +1,53 @@
+#pragma once
+#include <raylib.h>
+#include <cstdint>
+#include <vector>
+
+class RenderCommandBuffer;
+
+// Мінімапа з теплокартою щільності ворогів.
+// Вороги біняться в сітку на CPU і з частотою update_rate вивантажуються в малу текстуру;
+// щокадру малюються лише квад текстури, маркер гравця і рамка камери — ціна не залежить від кількості ворогів.
+// refresh() і record() викликає потік симуляції, upload() — лише потік рендера в точці синхронізації
+class Minimap {
+public:
+  static constexpr float DEFAULT_UPDATE_RATE = 10.f;
+  static constexpr int DEFAULT_RESOLUTION = 64;
+  // Стільки ворогів у клітинці дають максимальну яскравість
+  static constexpr float DENSITY_SATURATION = 6.f;
+
+private:
+  Vector2 world_size_;
+  int size_;
+  int bins_x_;
+  int bins_y_;
+  float update_interval_;
+  float update_timer_ = 0.f;
+
+  std::vector<std::uint16_t> density_;
+  std::vector<Color> pixels_;
+  Texture2D texture_ = {0, 0, 0, 0, 0};
+  bool pixels_dirty_ = false;
+
+public:
+  Minimap(Vector2 world_size, int size, int resolution = DEFAULT_RESOLUTION, float update_rate = DEFAULT_UPDATE_RATE);
+  ~Minimap();
+
+  Minimap(const Minimap&) = delete;
+  Minimap& operator=(const Minimap&) = delete;
+
+  // true, коли настав час перебудувати теплокарту
+  bool tick(float delta_time);
+
+  void clear_density();
+  void add_point(Vector2 world_position);
+  // Перетворює накопичену щільність у пікселі; у текстуру вони потраплять на наступному upload()
+  void refresh();
+  void upload();
+
+  void record(RenderCommandBuffer &commands, Vector2 screen_position, Vector2 player_position,
+              const Rectangle &camera_bounds) const;
+
+  void set_update_rate(float update_rate);
+  int get_size() const { return size_; }
+};
@@ -13,7 +13,7 @@ public:
 
   explicit PlayerCamera(Vector2 world_size, Vector2 screen_size, float follow_speed = 5.f);
 
-  void update(Vector2 target_pos);
+  void update(Vector2 target_pos, float delta_time);
   void begin_mode() const;
   void end_mode() const;
 
@@ -23,6 +23,7 @@ public:
 
   Rectangle get_camera_bounds() const;
 
+  const Camera2D& get_camera() const { return camera_; }
   Vector2 get_position() const { return camera_.target; }
   Vector2 get_offset() const { return camera_.offset; }
   float get_zoom() const { return camera_.zoom; }
@@ -1,7 +1,14 @@
 #pragma once
 #include "raylib.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
+
+#include "core/LocalizationCatalog.h"
 
 enum class Language {
   English,
@@ -9,26 +16,101 @@ enum class Language {
   // Можна додавати інші мови в майбутньому
 };
 
+constexpr size_t LANGUAGE_COUNT = 2;
+
+// Ідентифікатори рядків інтерфейсу — індекс у пласкій таблиці [ключ][мова], без хешування на гарячому шляху
+enum class TextId : std::uint16_t {
+  // UI Elements
+  Health,
+  Killed,
+  Time,
+  Enemies,
+  Bullets,
+  Seconds,
+  // Game States
+  Paused,
+  GameOver,
+  GameTitle,
+  // Controls
+  RestartHint,
+  ContinueHint,
+  MoveControls,
+  AutoShootHint,
+  LanguageSwitch,
+  // Game Messages
+  GameStart,
+  EnemySpawn,
+  HitTarget,
+  EnemyKilled,
+  PlayerDamaged,
+  GameRestart,
+  DifficultyIncrease,
+  SurvivalStats,
+  SpawnRate,
+  // Debug Info
+  DebugInfo,
+  Fps,
+  Delta,
+  SpawnTimer,
+  ShootTimer,
+  SpawnInterval,
+  MaxEnemies,
+  VisibleCulled,
+  PlayerPos,
+
+  Count
+};
+
+constexpr size_t TEXT_ID_COUNT = static_cast<size_t>(TextId::Count);
+
 class TextUtils {
 private:
-  static std::unordered_map<std::string, std::unordered_map<Language, std::string>> translations_;
+  // Каталоги відображаються ліниво, при першому зверненні до мови. Перевідкриття (set_ascii_only,
+  // init_translations) не закриває старе відображення, а відкладає його в retired_catalogs_ —
+  // вказівники на рядки, вже видані get_text (напр. у HudText), живуть до кінця програми
+  static std::array<LocalizationCatalog, LANGUAGE_COUNT> catalogs_;
+  static std::vector<LocalizationCatalog> retired_catalogs_;
+  static std::array<bool, LANGUAGE_COUNT> catalog_requested_;
+  // Рядки каталогу, розв'язані за TextId при відкритті; nullptr — фолбек на вбудовану англійську
+  static std::array<std::array<const char*, TEXT_ID_COUNT>, LANGUAGE_COUNT> resolved_;
+  static std::string catalog_directory_;
+  // Шрифт без потрібних гліфів: мови з нелатинським письмом беруть транслітерований каталог
+  static bool ascii_only_;
+  // Повільний шлях: ключі, додані під час роботи, і відсутні ключі (щоб повернений вказівник не висів)
+  static std::unordered_map<std::string, std::array<std::string, LANGUAGE_COUNT>> dynamic_translations_;
   static Language current_language_;
 
 public:
-  static void init_translations();
+  // Порожній каталог — <тека програми>/lang/, куди збірка кладе скомпільовані .bloc
+  static void init_translations(const std::string& catalog_directory = "");
   static void set_language(Language lang);
   static Language get_current_language();
 
-  // Основні методи для отримання тексту
-  static const char* get_text(const std::string& key);
-  static std::string get_formatted_text(const std::string& key, const std::string& format_args);
+  // Вмикається, коли атлас гліфів не зібрався; перевідкриває каталоги при наступному зверненні
+  static void set_ascii_only(bool ascii_only);
+  static bool is_ascii_only();
+  // Відсортовані унікальні кодпоінти всіх рядків усіх мов (разом з друкованим ASCII) — набір для атласу шрифту
+  static std::vector<int> collect_codepoints();
+
+  // Основні методи для отримання тексту; вказівник живе до кінця програми
+  static const char* get_text(TextId id);
+  static const char* get_text(TextId id, Language lang);
+  // Для динамічних ключів: лінійний пошук серед статичних, потім хеш-таблиця
+  static const char* get_text(std::string_view key);
+  static std::string_view get_key(TextId id);
+  static std::string get_formatted_text(std::string_view key, const std::string& format_args);
 
   // Методи для малювання
-  static void draw_text_localized(const std::string& key, int x, int y, int size, Color color);
-  static void draw_text_centered(const std::string& key, int center_x, int y, int size, Color color);
-  static int get_text_width(const std::string& key, int font_size);
+  static void draw_text_localized(TextId id, int x, int y, int size, Color color);
+  static void draw_text_centered(TextId id, int center_x, int y, int size, Color color);
+  static int get_text_width(TextId id, int font_size);
 
   // Утилітарні методи
-  static bool has_translation(const std::string& key);
+  static bool has_translation(std::string_view key);
   static void add_translation(const std::string& key, Language lang, const std::string& text);
+
+private:
+  static bool find_id(std::string_view key, TextId* out_id);
+  static void ensure_catalog(Language lang);
+  static std::string get_catalog_path(Language lang, bool ascii_only);
 };
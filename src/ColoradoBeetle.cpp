@@ -2,31 +2,38 @@
 
 #include <algorithm>
 
+#include "EnemyFactory.h"
+#include "systems/RenderCommandBuffer.h"
+
+
+namespace {
+
+const EnemyStats &STATS = *EnemyFactory::get_stats(EnemyType::ColoradoBeetle);
+
+} // namespace
 
 ColoradoBeetle::ColoradoBeetle(const Vector2 position)
-  : Enemy(position, 30.f,150.f,10.f,15.f)
-  , color_(ORANGE)
+  : Enemy(position, STATS.health, STATS.speed, STATS.damage, STATS.radius)
+  , color_(STATS.color)
 {}
 
-void ColoradoBeetle::update(const Vector2 &targetPos) {
-
-  const auto delta_time = GetFrameTime();
+void ColoradoBeetle::update(const Vector2 &targetPos, const float delta_time) {
   move_towards(targetPos, delta_time);
 
   attackCooldown_ = std::max(0.f, attackCooldown_ - delta_time);
 
   if (attackCooldown_ <= 0.f) {
     attack_logic();
-    attackCooldown_ = ATTACK_INTERVAL;
+    attackCooldown_ = STATS.attack_interval;
   }
 }
 
-void ColoradoBeetle::draw() const {
-  DrawCircleV(position_, radius_, color_);
+void ColoradoBeetle::draw(RenderCommandBuffer &commands) const {
+  commands.add_circle(position_, radius_, color_);
 
-  DrawCircleV({position_.x - 5, position_.y - 3}, 2, BLACK);
-  DrawCircleV({position_.x + 5, position_.y - 3}, 2, BLACK);
-  DrawCircleV({position_.x, position_.y + 5}, 3, DARKBROWN);
+  commands.add_circle({position_.x - 5, position_.y - 3}, 2, BLACK);
+  commands.add_circle({position_.x + 5, position_.y - 3}, 2, BLACK);
+  commands.add_circle({position_.x, position_.y + 5}, 3, DARKBROWN);
 
   // Індикатор здоров'я
   const float health_bar_width = radius_ * 2.0f;
@@ -34,22 +41,20 @@ void ColoradoBeetle::draw() const {
   const float health_percentage = health_ / max_health_;
 
   // Фон health bar
-  DrawRectangle(
-      static_cast<int>(position_.x - health_bar_width/2),
-      static_cast<int>(position_.y - radius_ - 10),
-      static_cast<int>(health_bar_width),
-      static_cast<int>(health_bar_height),
-      RED
-  );
+  commands.add_rect(Rectangle{
+      position_.x - health_bar_width/2,
+      position_.y - radius_ - 10,
+      health_bar_width,
+      health_bar_height
+  }, RED);
 
   // Актуальне здоров'я
-  DrawRectangle(
-      static_cast<int>(position_.x - health_bar_width/2),
-      static_cast<int>(position_.y - radius_ - 10),
-      static_cast<int>(health_bar_width * health_percentage),
-      static_cast<int>(health_bar_height),
-      GREEN
-  );
+  commands.add_rect(Rectangle{
+      position_.x - health_bar_width/2,
+      position_.y - radius_ - 10,
+      health_bar_width * health_percentage,
+      health_bar_height
+  }, GREEN);
 }
 
 void ColoradoBeetle::attack_logic() {
@@ -2,6 +2,8 @@
 #include <raylib.h>
 #include <raymath.h>
 
+#include "core/Steering.h"
+
 Enemy::Enemy(Vector2 position, float health, float speed, float damage, float radius)
   : position_{position}
     , velocity_{0.0f, 0.0f}
@@ -30,25 +32,7 @@ void Enemy::take_damage(float damage) {
 }
 
 void Enemy::move_towards(const Vector2 &target, float delta_time) {
-  Vector2 direction = {
-    target.x - position_.x,
-    target.y - position_.y
-  };
-
-  float distance = std::sqrt(direction.x * direction.x + direction.y * direction.y);
-
-  if (distance > radius_) {
-    direction.x /= distance;
-    direction.y /= distance;
-
-    velocity_ = {
-      direction.x * speed_,
-      direction.y * speed_
-    };
-
-    position_.x += velocity_.x * delta_time;
-    position_.y += velocity_.y * delta_time;
-  } else {
-    velocity_ = {0.f, 0.f};
-  }
+  // Пачка з одного агента: та сама формула, що й у пакетному переслідуванні ECS-ворогів
+  const Steering::ChaseBatch self = {&position_.x, &position_.y, &velocity_.x, &velocity_.y, &speed_, 1};
+  Steering::chase(self, target, radius_, delta_time);
 }
@@ -1,10 +1,45 @@
 #include "EnemyFactory.h"
+
+#include <array>
+
 #include "ColoradoBeetle.h"
+#include "Constants.h"
+#include "components/Collider.h"
+#include "components/Sprite.h"
+#include "components/Transform.h"
+#include "core/EntityManager.h"
 
 
 std::random_device EnemyFactory::rd_;
 std::mt19937 EnemyFactory::gen_{rd_()};
 
+namespace {
+
+namespace EnemyConstants = GameConstants::Enemy;
+
+// Порядок — як у EnemyType
+constexpr std::array<EnemyStats, ENEMY_TYPE_COUNT> STATS = {{
+  {EnemyConstants::ColoradoBeetle::HEALTH, EnemyConstants::ColoradoBeetle::SPEED, EnemyConstants::ColoradoBeetle::DAMAGE,
+   EnemyConstants::ColoradoBeetle::RADIUS, EnemyConstants::ColoradoBeetle::ATTACK_INTERVAL, EnemyConstants::ColoradoBeetle::COLOR},
+  {EnemyConstants::Aphid::HEALTH, EnemyConstants::Aphid::SPEED, EnemyConstants::Aphid::DAMAGE,
+   EnemyConstants::Aphid::RADIUS, EnemyConstants::Aphid::ATTACK_INTERVAL, EnemyConstants::Aphid::COLOR},
+  {EnemyConstants::Wireworm::HEALTH, EnemyConstants::Wireworm::SPEED, EnemyConstants::Wireworm::DAMAGE,
+   EnemyConstants::Wireworm::RADIUS, EnemyConstants::Wireworm::ATTACK_INTERVAL, EnemyConstants::Wireworm::COLOR},
+  {EnemyConstants::MoleCricket::HEALTH, EnemyConstants::MoleCricket::SPEED, EnemyConstants::MoleCricket::DAMAGE,
+   EnemyConstants::MoleCricket::RADIUS, EnemyConstants::MoleCricket::ATTACK_INTERVAL, EnemyConstants::MoleCricket::COLOR},
+  {EnemyConstants::Cutworm::HEALTH, EnemyConstants::Cutworm::SPEED, EnemyConstants::Cutworm::DAMAGE,
+   EnemyConstants::Cutworm::RADIUS, EnemyConstants::Cutworm::ATTACK_INTERVAL, EnemyConstants::Cutworm::COLOR},
+}};
+
+// Відносна частота появи відкритого типу; жук лишається основним ворогом
+constexpr std::array<double, ENEMY_TYPE_COUNT> SPAWN_WEIGHTS = {4.0, 3.0, 2.0, 1.0, 1.0};
+constexpr std::array<int, ENEMY_TYPE_COUNT> UNLOCK_LEVELS = {
+  1, EnemyConstants::APHID_LEVEL, EnemyConstants::WIREWORM_LEVEL, EnemyConstants::MOLE_CRICKET_LEVEL,
+  EnemyConstants::CUTWORM_LEVEL
+};
+
+} // namespace
+
 std::unique_ptr<Enemy> EnemyFactory::create_enemy(EnemyType type, Vector2 position) {
   switch (type) {
     case EnemyType::ColoradoBeetle:
@@ -19,8 +54,66 @@ std::unique_ptr<Enemy> EnemyFactory::create_random_enemy_for_level(int level, Ve
   return create_enemy(type, position);
 }
 
-EnemyType EnemyFactory::get_random_type_for_level(int level) {
-  return EnemyType::ColoradoBeetle;
+Entity* EnemyFactory::create_enemy_entity(EntityManager &manager, const EnemyType type, const Vector2 position) {
+  if (!get_stats(type)) {
+    return nullptr;
+  }
+
+  Entity *entity = manager.create_entity();
+  add_enemy_components(entity);
+  reset_enemy_entity(entity, type, position);
+  return entity;
 }
 
+void EnemyFactory::add_enemy_components(Entity *entity) {
+  using namespace Components;
+  entity->add_component<Transform>();
+  entity->add_component<Sprite>();
+  entity->add_component<Chaser>();
 
+  // Тригер: дотик до гравця — ігрова подія, а не фізичне розштовхування
+  auto *collider = entity->add_component<Collider>(0.f, CollisionLayer::ENEMY, true);
+  collider->mask = CollisionLayer::PLAYER;
+}
+
+bool EnemyFactory::reset_enemy_entity(Entity *entity, const EnemyType type, const Vector2 position) {
+  const EnemyStats *stats = get_stats(type);
+  if (!stats) {
+    return false;
+  }
+
+  using namespace Components;
+  auto *transform = entity->get_component<Transform>();
+  transform->position = position;
+  transform->velocity = {0.f, 0.f};
+  transform->wake();
+
+  auto *sprite = entity->get_component<Sprite>();
+  sprite->primitive_radius = stats->radius;
+  sprite->primitive_color = stats->color;
+
+  *entity->get_component<Chaser>() = Chaser(type);
+  entity->get_component<Collider>()->radius = stats->radius;
+  return true;
+}
+
+const EnemyStats* EnemyFactory::get_stats(const EnemyType type) {
+  const auto index = static_cast<size_t>(type);
+  return index < STATS.size() ? &STATS[index] : nullptr;
+}
+
+EnemyType EnemyFactory::get_random_type_for_level(const int level) {
+  // Зважений вибір без std::discrete_distribution — той виділяє пам'ять при кожному створенні
+  double total = 0.0;
+  for (size_t i = 0; i < ENEMY_TYPE_COUNT; ++i) {
+    if (level >= UNLOCK_LEVELS[i]) total += SPAWN_WEIGHTS[i];
+  }
+
+  double pick = std::uniform_real_distribution<double>(0.0, total)(gen_);
+  for (size_t i = 0; i < ENEMY_TYPE_COUNT; ++i) {
+    if (level < UNLOCK_LEVELS[i]) continue;
+    if (pick < SPAWN_WEIGHTS[i]) return static_cast<EnemyType>(i);
+    pick -= SPAWN_WEIGHTS[i];
+  }
+  return EnemyType::ColoradoBeetle;
+}
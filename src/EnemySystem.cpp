@@ -0,0 +1,545 @@
+#include "EnemySystem.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "Constants.h"
+#include "EnemyFactory.h"
+#include "components/Transform.h"
+#include "core/Steering.h"
+#include "systems/FlowField.h"
+
+namespace {
+
+using Batch = EnemySystem::Batch;
+
+// Агенти [begin, end) пачки як вхід пакетного переслідування; крок часу — власний у кожного
+Steering::ChaseBatch view_of(Batch &batch, const size_t begin, const size_t end) {
+  Steering::ChaseBatch view = {batch.position_x.data() + begin, batch.position_y.data() + begin,
+                               batch.velocity_x.data() + begin, batch.velocity_y.data() + begin,
+                               batch.speed.data() + begin, end - begin};
+  view.delta_time = batch.step_time.data() + begin;
+  if (batch.use_waypoints) {
+    view.target_x = batch.waypoint_x.data() + begin;
+    view.target_y = batch.waypoint_y.data() + begin;
+  }
+  return view;
+}
+
+// Точка на крок клітинки вздовж поля напрямків; хто бачить ціль або стоїть у її клітинці, іде прямо на неї
+void assign_waypoints(Batch &batch, const size_t begin, const size_t end, const FlowField &flow_field,
+                      const Vector2 target) {
+  const float lookahead = flow_field.get_cell_size();
+  for (size_t i = begin; i < end; ++i) {
+    const Vector2 position = {batch.position_x[i], batch.position_y[i]};
+    const Vector2 direction = flow_field.has_line_of_sight(position) ? Vector2{0.f, 0.f} : flow_field.sample(position);
+    if (direction.x == 0.f && direction.y == 0.f) {
+      batch.waypoint_x[i] = target.x;
+      batch.waypoint_y[i] = target.y;
+    } else {
+      batch.waypoint_x[i] = position.x + direction.x * lookahead;
+      batch.waypoint_y[i] = position.y + direction.y * lookahead;
+    }
+  }
+}
+
+void integrate(Batch &batch, const size_t begin, const size_t end) {
+  for (size_t i = begin; i < end; ++i) {
+    batch.position_x[i] += batch.velocity_x[i] * batch.step_time[i];
+    batch.position_y[i] += batch.velocity_y[i] * batch.step_time[i];
+  }
+}
+
+// Перезарядка удару: відлік до нуля і новий цикл
+void tick_cooldowns(Batch &batch, const size_t begin, const size_t end, const float interval) {
+  for (size_t i = begin; i < end; ++i) {
+    const float cooldown = std::max(0.f, batch.cooldown[i] - batch.step_time[i]);
+    batch.cooldown[i] = cooldown <= 0.f ? interval : cooldown;
+  }
+}
+
+// Жук і попелиця: по прямій до цілі, впритул зупиняються
+void update_chasers(Batch &batch, const size_t begin, const size_t end, const EnemyStats &stats, const Vector2 target) {
+  Steering::chase(view_of(batch, begin, end), target, stats.radius, 0.f);
+  tick_cooldowns(batch, begin, end, stats.attack_interval);
+}
+
+// Дротяник: до прямого руху додається бічне коливання
+void update_wireworms(Batch &batch, const size_t begin, const size_t end, const EnemyStats &stats,
+                      const Vector2 target) {
+  namespace Wireworm = GameConstants::Enemy::Wireworm;
+  constexpr float full_turn = 2.f * PI;
+
+  Steering::steer(view_of(batch, begin, end), target, stats.radius);
+  for (size_t i = begin; i < end; ++i) {
+    batch.phase[i] = std::fmod(batch.phase[i] + Wireworm::ZIGZAG_FREQUENCY * batch.step_time[i], full_turn);
+
+    // Перпендикуляр до швидкості тієї ж довжини; зупинений ворог так і лишається на місці
+    const float lateral = std::sin(batch.phase[i]) * Wireworm::ZIGZAG_AMPLITUDE;
+    const float vx = batch.velocity_x[i];
+    const float vy = batch.velocity_y[i];
+    batch.velocity_x[i] = vx - vy * lateral;
+    batch.velocity_y[i] = vy + vx * lateral;
+  }
+  integrate(batch, begin, end);
+  tick_cooldowns(batch, begin, end, stats.attack_interval);
+}
+
+// Капустянка: cooldown — пауза до наступного ривка, phase — залишок поточного
+void update_mole_crickets(Batch &batch, const size_t begin, const size_t end, const EnemyStats &stats,
+                          const Vector2 target) {
+  namespace MoleCricket = GameConstants::Enemy::MoleCricket;
+
+  for (size_t i = begin; i < end; ++i) {
+    if (batch.phase[i] > 0.f) {
+      batch.phase[i] = std::max(0.f, batch.phase[i] - batch.step_time[i]);
+    } else {
+      batch.cooldown[i] = std::max(0.f, batch.cooldown[i] - batch.step_time[i]);
+      if (batch.cooldown[i] <= 0.f) {
+        batch.phase[i] = MoleCricket::DASH_DURATION;
+        batch.cooldown[i] = stats.attack_interval;
+      }
+    }
+    batch.speed[i] = batch.phase[i] > 0.f ? stats.speed * MoleCricket::DASH_MULTIPLIER : stats.speed;
+  }
+  Steering::chase(view_of(batch, begin, end), target, stats.radius, 0.f);
+}
+
+// Совка: повзе повільно, а в радіусі засідки різко прискорюється
+void update_cutworms(Batch &batch, const size_t begin, const size_t end, const EnemyStats &stats,
+                     const Vector2 target) {
+  namespace Cutworm = GameConstants::Enemy::Cutworm;
+  constexpr float ambush_radius_sq = Cutworm::AMBUSH_RADIUS * Cutworm::AMBUSH_RADIUS;
+
+  for (size_t i = begin; i < end; ++i) {
+    const float dx = target.x - batch.position_x[i];
+    const float dy = target.y - batch.position_y[i];
+    batch.speed[i] = dx * dx + dy * dy < ambush_radius_sq ? stats.speed * Cutworm::AMBUSH_MULTIPLIER : stats.speed;
+  }
+  Steering::chase(view_of(batch, begin, end), target, stats.radius, 0.f);
+  tick_cooldowns(batch, begin, end, stats.attack_interval);
+}
+
+// Повний крок поведінки типу для агентів [begin, end), кожен на свій step_time
+void step(const EnemyType type, Batch &batch, const size_t begin, const size_t end, const EnemyStats &stats,
+          const Vector2 target) {
+  if (begin == end) {
+    return;
+  }
+
+  switch (type) {
+    case EnemyType::ColoradoBeetle:
+    case EnemyType::Aphid:
+      update_chasers(batch, begin, end, stats, target);
+      break;
+    case EnemyType::Wireworm:
+      update_wireworms(batch, begin, end, stats, target);
+      break;
+    case EnemyType::MoleCricket:
+      update_mole_crickets(batch, begin, end, stats, target);
+      break;
+    case EnemyType::Cutworm:
+      update_cutworms(batch, begin, end, stats, target);
+      break;
+  }
+}
+
+// Далекі вороги: без поведінки типу — зсув базовою швидкістю прямо до цілі (чи до точки поля), без перельоту
+void advance_distant(Batch &batch, const size_t begin, const size_t end, const EnemyStats &stats,
+                     const Vector2 target) {
+  for (size_t i = begin; i < end; ++i) {
+    const float dx = (batch.use_waypoints ? batch.waypoint_x[i] : target.x) - batch.position_x[i];
+    const float dy = (batch.use_waypoints ? batch.waypoint_y[i] : target.y) - batch.position_y[i];
+    const float distance = std::sqrt(dx * dx + dy * dy);
+    if (distance <= stats.radius) {
+      batch.velocity_x[i] = 0.f;
+      batch.velocity_y[i] = 0.f;
+      continue;
+    }
+
+    batch.velocity_x[i] = dx / distance * stats.speed;
+    batch.velocity_y[i] = dy / distance * stats.speed;
+    const float travel = std::min(stats.speed * batch.step_time[i], distance - stats.radius) / distance;
+    batch.position_x[i] += dx * travel;
+    batch.position_y[i] += dy * travel;
+  }
+}
+
+// Крок часу агентів [begin, end) — від попереднього кроку кожного до clock; час до появи не рахується
+void stage(Batch &batch, const size_t begin, const size_t end, const double clock) {
+  for (size_t i = begin; i < end; ++i) {
+    batch.step_time[i] = static_cast<float>(clock - batch.last_step[i]);
+    batch.last_step[i] = clock;
+  }
+}
+
+// Відстань від точки до прямокутника; нуль усередині
+float distance_to(const Rectangle &bounds, const float x, const float y) {
+  const float dx = std::max({bounds.x - x, 0.f, x - (bounds.x + bounds.width)});
+  const float dy = std::max({bounds.y - y, 0.f, y - (bounds.y + bounds.height)});
+  return std::sqrt(dx * dx + dy * dy);
+}
+
+// Рівень з гістерезисом: підвищення — за ближчим порогом, пониження — за дальшим,
+// тож ворог на межі не перемикається щокадру
+SimulationLod classify(const SimulationLod current, const float distance) {
+  namespace Performance = GameConstants::Performance;
+
+  if (distance <= Performance::LOD_VISIBLE_ENTER_MARGIN ||
+      (current == SimulationLod::VISIBLE && distance <= Performance::LOD_VISIBLE_EXIT_MARGIN)) {
+    return SimulationLod::VISIBLE;
+  }
+  if (distance <= Performance::LOD_DISTANT_EXIT_DISTANCE ||
+      (current != SimulationLod::DISTANT && distance <= Performance::LOD_DISTANT_ENTER_DISTANCE)) {
+    return SimulationLod::NEARBY;
+  }
+  return SimulationLod::DISTANT;
+}
+
+// Рівень агента в групі group
+SimulationLod lod_of(const size_t group) {
+  if (group == EnemySystem::VISIBLE_GROUP) {
+    return SimulationLod::VISIBLE;
+  }
+  return group < EnemySystem::distant_group(0) ? SimulationLod::NEARBY : SimulationLod::DISTANT;
+}
+
+// Група рівня lod для сутності; кошик сталий, тож зміна рівня не зсуває її черги кроку
+size_t group_of(const SimulationLod lod, const Entity &entity) {
+  const size_t bucket = entity.get_id() % EnemySystem::LOD_BUCKET_COUNT;
+  switch (lod) {
+    case SimulationLod::VISIBLE:
+      return EnemySystem::VISIBLE_GROUP;
+    case SimulationLod::NEARBY:
+      return EnemySystem::nearby_group(bucket);
+    case SimulationLod::DISTANT:
+      break;
+  }
+  return EnemySystem::distant_group(bucket);
+}
+
+// Стартова фаза з id, щоб вороги одного типу не рухались синхронно
+float initial_phase(const EntityID id, const float period) {
+  return static_cast<float>(id % 97) / 97.f * period;
+}
+
+} // namespace
+
+void EnemySystem::register_entity(Entity *entity) {
+  auto *chaser = entity ? entity->get_component<Components::Chaser>() : nullptr;
+  const auto *transform = entity ? entity->get_component<Components::Transform>() : nullptr;
+  const EnemyStats *stats = chaser ? EnemyFactory::get_stats(chaser->type) : nullptr;
+  if (!transform || !stats || chaser->batch_index != Components::Chaser::NO_BATCH) {
+    return;
+  }
+
+  Batch &batch = batches_[static_cast<size_t>(chaser->type)];
+  chaser->batch_index = static_cast<std::uint32_t>(batch.size());
+
+  float cooldown = 0.f;
+  float phase = 0.f;
+  switch (chaser->type) {
+    case EnemyType::Wireworm:
+      phase = initial_phase(entity->get_id(), 2.f * PI);
+      break;
+    case EnemyType::MoleCricket:
+      cooldown = initial_phase(entity->get_id(), stats->attack_interval);
+      break;
+    default:
+      break;
+  }
+
+  batch.position_x.push_back(transform->position.x);
+  batch.position_y.push_back(transform->position.y);
+  batch.velocity_x.push_back(0.f);
+  batch.velocity_y.push_back(0.f);
+  batch.speed.push_back(stats->speed);
+  batch.waypoint_x.push_back(transform->position.x);
+  batch.waypoint_y.push_back(transform->position.y);
+  batch.health.push_back(static_cast<int>(stats->health));
+  batch.cooldown.push_back(cooldown);
+  batch.phase.push_back(phase);
+  batch.entities.push_back(entity);
+  batch.last_step.push_back(clock_);
+  batch.step_time.push_back(0.f);
+
+  // Новий агент стає в кінець, тобто в останню групу, і одразу переходить на рівень за останньою видимою областю
+  batch.group.push_back(static_cast<std::uint8_t>(LOD_GROUP_COUNT - 1));
+  const SimulationLod lod = classify(SimulationLod::DISTANT,
+                                     distance_to(view_bounds_, transform->position.x, transform->position.y));
+  move_to_group(batch, batch.size() - 1, group_of(lod, *entity));
+}
+
+void EnemySystem::unregister_entity(const Entity *entity) {
+  std::uint32_t index = 0;
+  Batch *batch = find_batch(entity, index);
+  if (!batch) {
+    return;
+  }
+
+  // Спершу в останню групу (вона в кінці пачки), потім обмін з останнім — групи лишаються суцільними
+  const size_t last = batch->size() - 1;
+  swap_agents(*batch, move_to_group(*batch, index, LOD_GROUP_COUNT - 1), last);
+
+  batch->position_x.pop_back();
+  batch->position_y.pop_back();
+  batch->velocity_x.pop_back();
+  batch->velocity_y.pop_back();
+  batch->speed.pop_back();
+  batch->waypoint_x.pop_back();
+  batch->waypoint_y.pop_back();
+  batch->health.pop_back();
+  batch->cooldown.pop_back();
+  batch->phase.pop_back();
+  batch->entities.pop_back();
+  batch->last_step.pop_back();
+  batch->step_time.pop_back();
+  batch->group.pop_back();
+  entity->get_component<Components::Chaser>()->batch_index = Components::Chaser::NO_BATCH;
+}
+
+void EnemySystem::clear_entities() {
+  for (Batch &batch : batches_) {
+    for (const Entity *entity : batch.entities) {
+      entity->get_component<Components::Chaser>()->batch_index = Components::Chaser::NO_BATCH;
+    }
+    batch.position_x.clear();
+    batch.position_y.clear();
+    batch.velocity_x.clear();
+    batch.velocity_y.clear();
+    batch.speed.clear();
+    batch.waypoint_x.clear();
+    batch.waypoint_y.clear();
+    batch.health.clear();
+    batch.cooldown.clear();
+    batch.phase.clear();
+    batch.entities.clear();
+    batch.last_step.clear();
+    batch.step_time.clear();
+    batch.group.clear();
+    batch.group_begin.fill(0);
+  }
+}
+
+void EnemySystem::reserve(const size_t capacity_per_type) {
+  for (Batch &batch : batches_) {
+    batch.position_x.reserve(capacity_per_type);
+    batch.position_y.reserve(capacity_per_type);
+    batch.velocity_x.reserve(capacity_per_type);
+    batch.velocity_y.reserve(capacity_per_type);
+    batch.speed.reserve(capacity_per_type);
+    batch.waypoint_x.reserve(capacity_per_type);
+    batch.waypoint_y.reserve(capacity_per_type);
+    batch.health.reserve(capacity_per_type);
+    batch.cooldown.reserve(capacity_per_type);
+    batch.phase.reserve(capacity_per_type);
+    batch.entities.reserve(capacity_per_type);
+    batch.last_step.reserve(capacity_per_type);
+    batch.step_time.reserve(capacity_per_type);
+    batch.group.reserve(capacity_per_type);
+  }
+  separation_.reserve(capacity_per_type);
+  lod_moves_.reserve(capacity_per_type);
+}
+
+void EnemySystem::update(const float delta_time, const Vector2 target, const Rectangle view_bounds) {
+  view_bounds_ = view_bounds;
+  clock_ += delta_time;
+  // Кошики невидимих крокують по черзі — ціна кадру рівна, а не стрибок раз на LOD_NEARBY_INTERVAL кадрів
+  const size_t bucket = frame_++ % LOD_BUCKET_COUNT;
+  const size_t nearby = nearby_group(bucket);
+  const size_t distant = distant_group(bucket);
+  // Без перешкод поле нічого не змінює — усі йдуть на ціль напряму, без вибірки
+  const bool use_waypoints = flow_field_ && flow_field_->has_obstacles();
+
+  for (size_t type = 0; type < batches_.size(); ++type) {
+    Batch &batch = batches_[type];
+    if (batch.size() == 0) {
+      continue;
+    }
+
+    stage(batch, 0, batch.nearby_begin(), clock_);
+    stage(batch, batch.group_begin[nearby], batch.group_end(nearby), clock_);
+    stage(batch, batch.group_begin[distant], batch.group_end(distant), clock_);
+
+    batch.use_waypoints = use_waypoints;
+    if (use_waypoints) {
+      assign_waypoints(batch, 0, batch.nearby_begin(), *flow_field_, target);
+      assign_waypoints(batch, batch.group_begin[nearby], batch.group_end(nearby), *flow_field_, target);
+      assign_waypoints(batch, batch.group_begin[distant], batch.group_end(distant), *flow_field_, target);
+    }
+
+    const auto enemy_type = static_cast<EnemyType>(type);
+    const EnemyStats &stats = *EnemyFactory::get_stats(enemy_type);
+    step(enemy_type, batch, 0, batch.nearby_begin(), stats, target);
+    step(enemy_type, batch, batch.group_begin[nearby], batch.group_end(nearby), stats, target);
+    advance_distant(batch, batch.group_begin[distant], batch.group_end(distant), stats, target);
+  }
+
+  separate(delta_time);
+  for (Batch &batch : batches_) {
+    publish(batch, 0, batch.nearby_begin());
+    publish(batch, batch.group_begin[nearby], batch.group_end(nearby));
+    publish(batch, batch.group_begin[distant], batch.group_end(distant));
+    reclassify(batch, bucket);
+  }
+}
+
+void EnemySystem::separate(const float delta_time) {
+  separation_.begin();
+  for (size_t type = 0; type < batches_.size(); ++type) {
+    const Batch &batch = batches_[type];
+    const float radius = EnemyFactory::get_stats(static_cast<EnemyType>(type))->radius;
+    for (size_t i = 0; i < batch.nearby_begin(); ++i) {
+      separation_.add({batch.position_x[i], batch.position_y[i]}, radius);
+    }
+  }
+  separation_.solve(delta_time);
+
+  // Розштовхуються лише видимі: агенти додавались пачка за пачкою, тож індекси йдуть у тому ж порядку
+  size_t agent = 0;
+  for (Batch &batch : batches_) {
+    for (size_t i = 0; i < batch.nearby_begin(); ++i, ++agent) {
+      const Vector2 position = separation_.get_position(agent);
+      batch.position_x[i] = position.x;
+      batch.position_y[i] = position.y;
+    }
+  }
+}
+
+bool EnemySystem::apply_damage(const Entity *entity, const int damage) {
+  std::uint32_t index = 0;
+  Batch *batch = find_batch(entity, index);
+  if (!batch || batch->health[index] <= 0) {
+    return false;
+  }
+
+  batch->health[index] = std::max(0, batch->health[index] - damage);
+  return batch->health[index] <= 0;
+}
+
+void EnemySystem::kill(const Entity *entity) {
+  std::uint32_t index = 0;
+  if (Batch *batch = find_batch(entity, index)) {
+    batch->health[index] = 0;
+  }
+}
+
+bool EnemySystem::is_alive(const Entity *entity) const {
+  std::uint32_t index = 0;
+  const Batch *batch = find_batch(entity, index);
+  return batch && batch->health[index] > 0;
+}
+
+float EnemySystem::get_health_percentage(const Entity *entity) const {
+  std::uint32_t index = 0;
+  const Batch *batch = find_batch(entity, index);
+  if (!batch) {
+    return 0.f;
+  }
+  const EnemyStats &stats = *EnemyFactory::get_stats(entity->get_component<Components::Chaser>()->type);
+  return static_cast<float>(batch->health[index]) / stats.health;
+}
+
+size_t EnemySystem::get_enemy_count() const {
+  size_t count = 0;
+  for (const Batch &batch : batches_) {
+    count += batch.size();
+  }
+  return count;
+}
+
+EnemySystem::LodCounts EnemySystem::get_lod_counts() const {
+  LodCounts counts;
+  for (const Batch &batch : batches_) {
+    counts.visible += batch.nearby_begin();
+    counts.nearby += batch.distant_begin() - batch.nearby_begin();
+    counts.distant += batch.size() - batch.distant_begin();
+  }
+  return counts;
+}
+
+EnemySystem::Batch* EnemySystem::find_batch(const Entity *entity, std::uint32_t &index) {
+  return const_cast<Batch*>(std::as_const(*this).find_batch(entity, index));
+}
+
+const EnemySystem::Batch* EnemySystem::find_batch(const Entity *entity, std::uint32_t &index) const {
+  const auto *chaser = entity ? entity->get_component<Components::Chaser>() : nullptr;
+  if (!chaser || chaser->batch_index == Components::Chaser::NO_BATCH) {
+    return nullptr;
+  }
+  index = chaser->batch_index;
+  return &batches_[static_cast<size_t>(chaser->type)];
+}
+
+void EnemySystem::swap_agents(Batch &batch, const size_t a, const size_t b) {
+  if (a == b) {
+    return;
+  }
+
+  std::swap(batch.position_x[a], batch.position_x[b]);
+  std::swap(batch.position_y[a], batch.position_y[b]);
+  std::swap(batch.velocity_x[a], batch.velocity_x[b]);
+  std::swap(batch.velocity_y[a], batch.velocity_y[b]);
+  std::swap(batch.speed[a], batch.speed[b]);
+  std::swap(batch.waypoint_x[a], batch.waypoint_x[b]);
+  std::swap(batch.waypoint_y[a], batch.waypoint_y[b]);
+  std::swap(batch.health[a], batch.health[b]);
+  std::swap(batch.cooldown[a], batch.cooldown[b]);
+  std::swap(batch.phase[a], batch.phase[b]);
+  std::swap(batch.last_step[a], batch.last_step[b]);
+  std::swap(batch.step_time[a], batch.step_time[b]);
+  std::swap(batch.group[a], batch.group[b]);
+  std::swap(batch.entities[a], batch.entities[b]);
+  batch.entities[a]->get_component<Components::Chaser>()->batch_index = static_cast<std::uint32_t>(a);
+  batch.entities[b]->get_component<Components::Chaser>()->batch_index = static_cast<std::uint32_t>(b);
+}
+
+size_t EnemySystem::move_to_group(Batch &batch, size_t index, const size_t group) {
+  // Кожен крок — обмін з крайнім агентом сусідньої групи і зсув межі на одиницю
+  while (batch.group[index] < group) {
+    const size_t next = batch.group[index] + 1;
+    swap_agents(batch, index, --batch.group_begin[next]);
+    index = batch.group_begin[next];
+    batch.group[index] = static_cast<std::uint8_t>(next);
+  }
+  while (batch.group[index] > group) {
+    const size_t current = batch.group[index];
+    swap_agents(batch, index, batch.group_begin[current]);
+    index = batch.group_begin[current]++;
+    batch.group[index] = static_cast<std::uint8_t>(current - 1);
+  }
+  return index;
+}
+
+void EnemySystem::reclassify(Batch &batch, const size_t bucket) {
+  // Переглядаються лише ті, хто крокував цього кадру. Переходи спершу збираються, а тоді застосовуються
+  // за batch_index: кожен move_to_group переставляє агентів на межах груп
+  lod_moves_.clear();
+  const auto collect = [&](const size_t begin, const size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      const SimulationLod current = lod_of(batch.group[i]);
+      const SimulationLod lod = classify(current, distance_to(view_bounds_, batch.position_x[i], batch.position_y[i]));
+      if (lod != current) {
+        lod_moves_.emplace_back(batch.entities[i], group_of(lod, *batch.entities[i]));
+      }
+    }
+  };
+  collect(0, batch.nearby_begin());
+  collect(batch.group_begin[nearby_group(bucket)], batch.group_end(nearby_group(bucket)));
+  collect(batch.group_begin[distant_group(bucket)], batch.group_end(distant_group(bucket)));
+
+  for (const auto &[entity, group] : lod_moves_) {
+    move_to_group(batch, entity->get_component<Components::Chaser>()->batch_index, group);
+  }
+}
+
+void EnemySystem::publish(const Batch &batch, const size_t begin, const size_t end) {
+  // Колізії, рендер і мінімапа читають ворогів через Transform
+  for (size_t i = begin; i < end; ++i) {
+    auto *transform = batch.entities[i]->get_component<Components::Transform>();
+    transform->position = {batch.position_x[i], batch.position_y[i]};
+    transform->velocity = {batch.velocity_x[i], batch.velocity_y[i]};
+  }
+}
@@ -1,65 +1,207 @@
 #include "Game.h"
 
 #include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <limits>
 #include <random>
 
-#include "Player.h"
-#include "Enemy.h"
-#include "Bullet.h"
-#include "ColoradoBeetle.h"
+#include "Minimap.h"
 #include "TextUtils.h"
+#include "components/Chaser.h"
+#include "components/Collider.h"
+#include "components/Health.h"
+#include "components/PlayerControl.h"
+#include "components/Projectile.h"
+#include "components/Sprite.h"
+#include "components/Transform.h"
+#include "core/SimulationThread.h"
+#include "core/ThreadPool.h"
+#include "systems/PrimitiveRenderer.h"
+#include "systems/RenderSystem.h"
+#include "systems/render/RenderBackend.h"
+
+namespace {
+
+// Значення HUD округлюються до кроку, який видно на екрані, — інакше рядок перерозкладався б щокадру
+float quantize(const float value, const float step) {
+  return std::round(value / step) * step;
+}
+
+void record_health_bar(RenderCommandBuffer &commands, const Vector2 position, const float width, const float y_offset,
+                       const float height, const float health_percentage) {
+  const Rectangle background = {position.x - width / 2, position.y + y_offset, width, height};
+  commands.add_rect(background, GameConstants::UI::Colors::HEALTH_BAR_BACKGROUND);
+  commands.add_rect(Rectangle{background.x, background.y, width * health_percentage, height},
+                    GameConstants::UI::Colors::HEALTH_BAR_FOREGROUND);
+}
+
+void record_player(RenderCommandBuffer &commands, const Entity &entity) {
+  namespace Player = GameConstants::Player;
+  const Vector2 position = entity.get_component<Components::Transform>()->position;
+  const auto *sprite = entity.get_component<Components::Sprite>();
+  const float radius = sprite->primitive_radius;
+
+  commands.add_circle(position, radius, sprite->primitive_color);
+  commands.add_circle({position.x - Player::EYE_OFFSET, position.y + Player::EYE_Y_OFFSET}, Player::EYE_RADIUS, BLACK);
+  commands.add_circle({position.x + Player::EYE_OFFSET, position.y + Player::EYE_Y_OFFSET}, Player::EYE_RADIUS, BLACK);
+
+  record_health_bar(commands, position, radius * 2.f, -radius + Player::HEALTH_BAR_Y_OFFSET, Player::HEALTH_BAR_HEIGHT,
+                    entity.get_component<Components::Health>()->get_health_percentage());
+}
+
+void record_enemy(RenderCommandBuffer &commands, const Entity &entity, const float health_percentage) {
+  namespace Beetle = GameConstants::Enemy::ColoradoBeetle;
+  const auto *transform = entity.get_component<Components::Transform>();
+  const Vector2 position = transform->position;
+  const auto *sprite = entity.get_component<Components::Sprite>();
+  const float radius = sprite->primitive_radius;
+
+  // Деталі типу, пропорційні радіусу, крім жука з його власними константами
+  switch (entity.get_component<Components::Chaser>()->type) {
+    case EnemyType::ColoradoBeetle:
+      commands.add_circle(position, radius, sprite->primitive_color);
+      commands.add_circle({position.x - Beetle::STRIPE_OFFSET_X, position.y - Beetle::STRIPE_OFFSET_Y}, Beetle::STRIPE_RADIUS, BLACK);
+      commands.add_circle({position.x + Beetle::STRIPE_OFFSET_X, position.y - Beetle::STRIPE_OFFSET_Y}, Beetle::STRIPE_RADIUS, BLACK);
+      commands.add_circle({position.x, position.y + Beetle::BODY_OFFSET_Y}, Beetle::BODY_RADIUS, DARKBROWN);
+      break;
+    case EnemyType::Aphid:
+      commands.add_circle(position, radius, sprite->primitive_color);
+      commands.add_circle({position.x, position.y - radius * 0.4f}, radius * 0.35f, LIME);
+      break;
+    case EnemyType::Wireworm: {
+      // Сегменти тягнуться за головою проти напрямку руху
+      const float speed = std::sqrt(transform->velocity.x * transform->velocity.x + transform->velocity.y * transform->velocity.y);
+      const Vector2 back = speed > 0.f
+        ? Vector2{-transform->velocity.x / speed, -transform->velocity.y / speed}
+        : Vector2{0.f, 1.f};
+      commands.add_circle({position.x + back.x * radius * 1.6f, position.y + back.y * radius * 1.6f}, radius * 0.6f, ORANGE);
+      commands.add_circle({position.x + back.x * radius * 0.8f, position.y + back.y * radius * 0.8f}, radius * 0.8f, sprite->primitive_color);
+      commands.add_circle(position, radius, sprite->primitive_color);
+      break;
+    }
+    case EnemyType::MoleCricket:
+      commands.add_circle(position, radius, sprite->primitive_color);
+      commands.add_circle({position.x - radius * 0.7f, position.y - radius * 0.6f}, radius * 0.3f, DARKBROWN);
+      commands.add_circle({position.x + radius * 0.7f, position.y - radius * 0.6f}, radius * 0.3f, DARKBROWN);
+      break;
+    case EnemyType::Cutworm:
+      commands.add_circle(position, radius, sprite->primitive_color);
+      commands.add_circle(position, radius * 0.6f, DARKGRAY);
+      commands.add_circle(position, radius * 0.25f, sprite->primitive_color);
+      break;
+  }
+
+  record_health_bar(commands, position, radius * 2.f, -radius + GameConstants::Enemy::HEALTH_BAR_Y_OFFSET,
+                    GameConstants::Enemy::HEALTH_BAR_HEIGHT, health_percentage);
+}
+
+void record_bullet(RenderCommandBuffer &commands, const Entity &entity) {
+  namespace Bullet = GameConstants::Bullet;
+  const auto *transform = entity.get_component<Components::Transform>();
+  const auto *sprite = entity.get_component<Components::Sprite>();
+  const Vector2 position = transform->position;
+  const float radius = sprite->primitive_radius;
+
+  commands.add_circle(position, radius, sprite->primitive_color);
+  // Сяйво і слід позаду кулі
+  commands.add_circle(position, radius * Bullet::GLOW_RADIUS_MULTIPLIER, WHITE);
+  const Vector2 trail = {
+    position.x - transform->velocity.x / Bullet::SPEED * Bullet::TRAIL_OFFSET,
+    position.y - transform->velocity.y / Bullet::SPEED * Bullet::TRAIL_OFFSET
+  };
+  commands.add_circle(trail, radius * Bullet::TRAIL_RADIUS_MULTIPLIER, ColorAlpha(sprite->primitive_color, Bullet::TRAIL_ALPHA));
+}
+
+} // namespace
 
 Game::~Game() = default;
 
 Game::Game(std::string title)
   : title_{std::move(title)}
-    , state_{GameState::PLAYING}
-    , player_(nullptr)
-    , enemies_{}
-    , bullets_{} {
+    , state_{GameState::PLAYING} {
   std::cout << "🎮 Створюємо гру: " << title_ << std::endl;
 }
 
 void Game::init() {
-  InitWindow(GameConstants::SCREEN_WIDTH, GameConstants::SCREEN_HEIGHT, title_.c_str());
-  SetTargetFPS(60);
+  RenderBackend &backend = RenderBackend::get();
+  backend.init_window(GameConstants::SCREEN_WIDTH, GameConstants::SCREEN_HEIGHT, title_.c_str());
+  backend.set_target_fps(60);
   TextUtils::init_translations();
-  InitAudioDevice();
+  init_font();
+  // Без вікна звук теж не потрібен — агенти збірки зазвичай не мають аудіопристрою
+  if (backend.get_type() == RenderBackendType::RAYLIB) {
+    InitAudioDevice();
+  }
 
   camera_ = std::make_unique<PlayerCamera>(
     Vector2{static_cast<float>(GameConstants::SCREEN_WIDTH), static_cast<float>(GameConstants::SCREEN_HEIGHT)},
     Vector2{static_cast<float>(GameConstants::WORLD_WIDTH), static_cast<float>(GameConstants::WORLD_HEIGHT)});
 
-  Vector2 player_start_pos = {
-    static_cast<float>(GameConstants::WORLD_WIDTH) / 2.f,
-    static_cast<float>(GameConstants::WORLD_HEIGHT) / 2.f
+  // Вороги без пересічних масок між собою, тож пари — лише гравець-ворог; при натовпі тюнер обере сітку
+  collision_system_.set_auto_tune(true);
+  collision_system_.add_collision_callback([this](const CollisionInfo &info) { on_collision(info); });
+  init_pools();
+  create_player();
+  primitive_renderer_ = std::make_unique<PrimitiveRenderer>();
+  render_system_ = std::make_unique<RenderSystem>();
+  init_static_layers();
+
+  minimap_ = std::make_unique<Minimap>(
+    Vector2{static_cast<float>(GameConstants::WORLD_WIDTH), static_cast<float>(GameConstants::WORLD_HEIGHT)},
+    GameConstants::UI::Minimap::SIZE,
+    GameConstants::UI::Minimap::DENSITY_RESOLUTION,
+    GameConstants::UI::Minimap::UPDATE_RATE);
+}
+
+void Game::init_static_layers() {
+  const Rectangle world_rect = {
+    0, 0, static_cast<float>(GameConstants::WORLD_WIDTH), static_cast<float>(GameConstants::WORLD_HEIGHT)
   };
 
-  player_ = std::make_unique<Player>(player_start_pos);
+  render_system_->set_static_layer(GameConstants::World::BACKGROUND_LAYER, world_rect,
+                                   [this] { draw_world_background(); });
+
+  // Рамка виходить на пів лінії за межі світу — даємо запас
+  constexpr float bounds_padding = 4.f;
+  render_system_->set_static_layer(GameConstants::World::BOUNDS_LAYER,
+                                   Rectangle{
+                                     -bounds_padding, -bounds_padding,
+                                     world_rect.width + bounds_padding * 2.f, world_rect.height + bounds_padding * 2.f
+                                   },
+                                   [this] { draw_world_bounds(); });
+}
+
+void Game::simulate_frame(const InputSnapshot &input) {
+  update(input);
+
+  RenderCommandBuffer &commands = command_buffers_[1 - front_buffer_];
+  commands.clear();
+  record_frame(commands, input);
+  commands.sort();
 }
 
-void Game::update() {
-  const float dt = GetFrameTime();
+void Game::update(const InputSnapshot &input) {
+  const float dt = input.delta_time;
 
   switch (state_) {
     case GameState::PLAYING:
-      update_timers();
+      update_timers(dt);
       game_time_ += dt;
       static float difficulty_timer = 5.f;
       difficulty_timer -= dt;
-      handle_input();
+      handle_input(input);
       if (difficulty_timer <= 0.f) {
         difficulty_timer = 5.f;
         update_difficulty();
       }
 
       if (player_) {
-        camera_->update(player_->get_position());
+        camera_->update(get_player_position(), dt);
       }
 
-      if (player_ && player_->is_alive()) {
-        player_->update();
+      if (is_player_alive()) {
+        update_player(input);
       } else if (state_ == GameState::PLAYING) {
         state_ = GameState::GAMEOVER;
       }
@@ -69,212 +211,247 @@ void Game::update() {
         spawn_timer_ = spawn_interval_;
       }
 
-      if (shoot_timer_ <= 0.f && !enemies_.empty()) {
+      if (shoot_timer_ <= 0.f && enemy_pool_.get_active_count() > 0) {
         spawn_bullet();
       }
 
-      for (const auto &e: enemies_) {
-        if (e && e->is_alive()) {
-          e->update(player_->get_position());
-        }
-      }
+      update_enemies(dt);
+      update_bullets(dt);
+      transform_system_.update(dt);
 
-      for (const auto &b: bullets_) {
-        if (b && b->is_active()) {
-          b->update();
-        }
+      // Після інтеграції: гравець лишається у світі, кулі за його межами гаснуть
+      if (player_) {
+        const float radius = GameConstants::Player::RADIUS;
+        TransformSystem::clamp_to_world_bounds(player_, Rectangle{
+          radius, radius, GameConstants::WORLD_WIDTH - radius * 2.f, GameConstants::WORLD_HEIGHT - radius * 2.f
+        });
       }
 
+      player_hit_this_frame_ = false;
+      collision_system_.update();
       check_collisions();
       cleanup_dead_objects();
+      update_minimap(dt);
       break;
     case GameState::BOSS:
       break;
     case GameState::PAUSE:
-      handle_input();
+      handle_input(input);
       break;
     case GameState::GAMEOVER:
-      handle_input();
+      handle_input(input);
       break;
     default:
       break;
   }
 }
 
-void Game::draw() const {
-  BeginDrawing();
-  Color background_color;
+void Game::record_frame(RenderCommandBuffer &commands, const InputSnapshot &input) {
   switch (state_) {
     using enum GameState;
     case PLAYING:
-      background_color = Color{34, 139, 34, 255};
+      commands.set_clear_color(Color{34, 139, 34, 255});
+      break;
+    case PAUSE:
+      commands.set_clear_color(Color{64, 64, 64, 255});
       break;
-  case PAUSE:
-      background_color = Color{64, 64, 64, 255};
-    break;
     case GAMEOVER:
-      background_color = Color{139, 34, 34, 255};
+      commands.set_clear_color(Color{139, 34, 34, 255});
       break;
     default:
-      background_color = BLACK;
+      commands.set_clear_color(BLACK);
   }
 
-  ClearBackground(background_color);
-
   if (state_ == GameState::PLAYING || state_ == GameState::PAUSE) {
-    camera_->begin_mode();
-    draw_world_background();
-    draw_game_objects();
-    draw_world_bounds();
-    camera_->end_mode();
+    commands.set_camera(camera_->get_camera());
+    commands.set_space(RenderSpace::WORLD);
+    record_game_objects(commands);
   }
 
-  draw_ui();
-  draw_minimap();
+  commands.set_space(RenderSpace::SCREEN);
+  record_ui(commands, input);
+  record_minimap(commands);
+}
 
-  EndDrawing();
+void Game::sync_frame() {
+  front_buffer_ = 1 - front_buffer_;
+  minimap_->upload();
+}
+
+void Game::draw() const {
+  const RenderCommandBuffer &commands = command_buffers_[front_buffer_];
+
+  RenderBackend &backend = RenderBackend::get();
+  backend.begin_frame(commands.get_clear_color());
+
+  if (commands.has_world()) {
+    // Перемальовуємо лише застарілі шари і до режиму камери — BeginTextureMode скидає її матрицю
+    render_system_->update_static_layers();
+
+    // Через камеру кадру, а не get_camera_bounds — так враховується зсув від тряски камери
+    const Camera2D &camera = commands.get_camera();
+    const Vector2 view_min = GetScreenToWorld2D({0, 0}, camera);
+    const Vector2 view_max = GetScreenToWorld2D({
+      static_cast<float>(GameConstants::SCREEN_WIDTH), static_cast<float>(GameConstants::SCREEN_HEIGHT)
+    }, camera);
+    const Rectangle view = {view_min.x, view_min.y, view_max.x - view_min.x, view_max.y - view_min.y};
+    backend.begin_mode_2d(camera);
+    render_system_->draw_static_layer(GameConstants::World::BACKGROUND_LAYER, view);
+    commands.execute(RenderSpace::WORLD, *primitive_renderer_);
+    render_system_->draw_static_layer(GameConstants::World::BOUNDS_LAYER, view);
+    backend.end_mode_2d();
+  }
+
+  commands.execute(RenderSpace::SCREEN, *primitive_renderer_);
+
+  backend.end_frame();
 }
 
 void Game::draw_world_background() const {
-  DrawRectangle(0, 0, GameConstants::WORLD_WIDTH, GameConstants::WORLD_HEIGHT, Color{34, 139, 34, 255});
+  RenderBackend &backend = RenderBackend::get();
+  backend.draw_rect(Rectangle{0, 0, GameConstants::WORLD_WIDTH, GameConstants::WORLD_HEIGHT}, Color{34, 139, 34, 255});
 
-  const int grid_size = 64;
+  constexpr int grid_size = 64;
   for (int x = 0; x < GameConstants::WORLD_WIDTH; x += grid_size) {
     for (int y = 0; y < GameConstants::WORLD_HEIGHT; y += grid_size) {
-      DrawRectangleLines(x, y, grid_size, grid_size, ColorAlpha(BLACK, 0.1f));
+      backend.draw_rect_lines(Rectangle{
+                                static_cast<float>(x), static_cast<float>(y), grid_size, grid_size
+                              }, ColorAlpha(BLACK, 0.1f));
     }
   }
 }
 
 void Game::draw_world_bounds() const {
-  DrawRectangleLines(0, 0, GameConstants::WORLD_WIDTH, GameConstants::WORLD_HEIGHT, RED);
+  RenderBackend &backend = RenderBackend::get();
+  backend.draw_rect_lines(Rectangle{0, 0, GameConstants::WORLD_WIDTH, GameConstants::WORLD_HEIGHT}, RED);
 
   constexpr int danger_zone = 20;
 
-  DrawRectangleLinesEx(Rectangle{
+  backend.draw_rect_lines_ex(Rectangle{
                          danger_zone, danger_zone, GameConstants::WORLD_WIDTH - danger_zone * 2, GameConstants::WORLD_HEIGHT - danger_zone * 2
                        }, 4.f, DARKPURPLE);
 }
 
-void Game::draw_minimap() const {
-  constexpr int minimap_size = 150;
+void Game::record_minimap(RenderCommandBuffer &commands) const {
+  const int minimap_size = minimap_->get_size();
   const int minimap_x = GameConstants::SCREEN_WIDTH - minimap_size - 10;
   const int minimap_y = 10;
 
-  DrawRectangle(minimap_x, minimap_y, minimap_size, minimap_size, ColorAlpha(BLACK, 0.7f));
-  DrawRectangleLines(minimap_x, minimap_y, minimap_size, minimap_size, Color{255, 255, 255, 255});
-
-  constexpr float scale_x = static_cast<float>(minimap_size) / GameConstants::WORLD_WIDTH;
-  constexpr float scale_y = static_cast<float>(minimap_size) / GameConstants::WORLD_HEIGHT;
+  const Vector2 player_position = get_player_position();
+  minimap_->record(commands, Vector2{static_cast<float>(minimap_x), static_cast<float>(minimap_y)},
+                   player_position, camera_->get_camera_bounds());
+}
 
-  if (player_) {
-    const auto pos = player_->get_position();
-    DrawCircle(minimap_x + static_cast<int>(pos.x * scale_x), minimap_y + static_cast<int>(pos.y * scale_y), 3.f, BLUE);
+void Game::update_minimap(const float dt) {
+  if (!minimap_->tick(dt)) {
+    return;
   }
 
-  for (const auto& e: enemies_) {
-    if (e && e->is_alive()) {
-      const auto pos = e->get_position();
-      DrawCircle(minimap_x + static_cast<int>(pos.x * scale_x), minimap_y + static_cast<int>(pos.y * scale_y), 1.f, RED);
-    }
+  minimap_->clear_density();
+  for (const Entity *enemy : enemy_pool_.get_active()) {
+    minimap_->add_point(enemy->get_component<Components::Transform>()->position);
   }
-
-  auto camera_bounds = camera_->get_camera_bounds();
-  DrawRectangleLines(
-    minimap_x + static_cast<int>(camera_bounds.x * scale_x),
-    minimap_y + static_cast<int>(camera_bounds.y * scale_y),
-     static_cast<int>(camera_bounds.width * scale_x),
-     static_cast<int>(camera_bounds.height * scale_y),
-     YELLOW);
+  minimap_->refresh();
 }
 
-void Game::draw_game_objects() const {
+void Game::record_game_objects(RenderCommandBuffer &commands) const {
+  visible_objects_ = 0;
+  culled_objects_ = 0;
+
   if (player_) {
-    player_->draw();
+    record_player(commands, *player_);
   }
 
-  for (const auto &e: enemies_) {
-    if (e && e->is_alive()) {
-      e->draw();
+  for (const Entity *enemy : enemy_pool_.get_active()) {
+    if (!is_position_in_camera(enemy->get_component<Components::Transform>()->position)) {
+      ++culled_objects_;
+      continue;
     }
+    record_enemy(commands, *enemy, enemy_system_.get_health_percentage(enemy));
+    ++visible_objects_;
   }
 
-  for (const auto &b: bullets_) {
-    if (b && b->is_active()) {
-      b->draw();
+  for (const Entity *bullet : bullet_pool_.get_active()) {
+    if (!is_position_in_camera(bullet->get_component<Components::Transform>()->position)) {
+      ++culled_objects_;
+      continue;
     }
+    record_bullet(commands, *bullet);
+    ++visible_objects_;
   }
 }
 
-void Game::draw_ui() const {
-  constexpr int ui_margin = 10;
-  constexpr int ui_font_size = 20;
-  constexpr int ui_line_height = 25;
+bool Game::is_position_in_camera(const Vector2 position, const float margin) const {
+  if (!camera_) {
+    return true;
+  }
 
-  int y_offset = ui_margin;
+  const Rectangle bounds = camera_->get_camera_bounds();
+  return position.x >= bounds.x - margin && position.x <= bounds.x + bounds.width + margin &&
+         position.y >= bounds.y - margin && position.y <= bounds.y + bounds.height + margin;
+}
 
+void Game::record_ui(RenderCommandBuffer &commands, const InputSnapshot &input) {
   // Здоров'я гравця
-  const int health = (player_ && player_->is_alive()) ? player_->get_health() : 0;
-  DrawText(TextFormat("%s: %d", TextUtils::get_text("health"), health),
-           ui_margin, y_offset, ui_font_size, WHITE);
-  y_offset += ui_line_height;
+  const int health = is_player_alive() ? player_->get_component<Components::Health>()->current_health : 0;
+  hud_.health.set(TextUtils::get_text(TextId::Health), health);
+  hud_.health.record(commands);
 
   // Статистика
-  DrawText(TextFormat("%s: %d", TextUtils::get_text("killed"), kill_count_),
-           ui_margin, y_offset, ui_font_size, WHITE);
-  y_offset += ui_line_height;
+  hud_.killed.set(TextUtils::get_text(TextId::Killed), kill_count_);
+  hud_.killed.record(commands);
 
-  DrawText(TextFormat("%s: %.1f %s", TextUtils::get_text("time"), game_time_, TextUtils::get_text("seconds")),
-           ui_margin, y_offset, ui_font_size, WHITE);
-  y_offset += ui_line_height;
+  hud_.time.set(TextUtils::get_text(TextId::Time), quantize(game_time_, 0.1f), TextUtils::get_text(TextId::Seconds));
+  hud_.time.record(commands);
 
-  DrawText(TextFormat("%s: %zu", TextUtils::get_text("enemies"), enemies_.size()),
-           ui_margin, y_offset, ui_font_size, WHITE);
-  y_offset += ui_line_height;
+  hud_.enemies.set(TextUtils::get_text(TextId::Enemies), enemy_pool_.get_active_count());
+  hud_.enemies.record(commands);
 
-  DrawText(TextFormat("%s: %zu", TextUtils::get_text("bullets"), bullets_.size()),
-           ui_margin, y_offset, ui_font_size, WHITE);
+  hud_.bullets.set(TextUtils::get_text(TextId::Bullets), bullet_pool_.get_active_count());
+  hud_.bullets.record(commands);
 
-  draw_state_messages();
+  record_state_messages(commands);
 
 #ifdef _DEBUG
-  draw_debug_info();
+  record_debug_info(commands, input);
+#else
+  (void)input;
 #endif
 }
 
-void Game::draw_state_messages() const {
-  constexpr int center_x = GameConstants::SCREEN_WIDTH / 2;
-  constexpr int center_y = GameConstants::SCREEN_HEIGHT / 2;
-
+void Game::record_state_messages(RenderCommandBuffer &commands) {
   switch (state_) {
     case GameState::PAUSE: {
-      TextUtils::draw_text_centered("paused", center_x, center_y - 20, 40, YELLOW);
-      TextUtils::draw_text_centered("continue_hint", center_x, center_y + 30, 20, WHITE);
-      TextUtils::draw_text_centered("language_switch", center_x, center_y + 60, 16, LIGHTGRAY);
+      hud_.paused.set(TextUtils::get_text(TextId::Paused));
+      hud_.continue_hint.set(TextUtils::get_text(TextId::ContinueHint));
+      hud_.pause_language.set(TextUtils::get_text(TextId::LanguageSwitch));
+      hud_.paused.record(commands);
+      hud_.continue_hint.record(commands);
+      hud_.pause_language.record(commands);
       break;
     }
 
     case GameState::GAMEOVER: {
-      TextUtils::draw_text_centered("game_over", center_x, center_y - 25, 50, RED);
-      TextUtils::draw_text_centered("restart_hint", center_x, center_y + 40, 25, WHITE);
-
-      const char *stats_format = TextUtils::get_text("survival_stats");
-      const char *final_stats = TextFormat(stats_format, game_time_, kill_count_);
-      const int stats_width = MeasureText(final_stats, 20);
-      DrawText(final_stats, center_x - stats_width / 2, center_y + 80, 20, LIGHTGRAY);
-
-      TextUtils::draw_text_centered("language_switch", center_x, center_y + 110, 16, LIGHTGRAY);
+      hud_.game_over.set(TextUtils::get_text(TextId::GameOver));
+      hud_.restart_hint.set(TextUtils::get_text(TextId::RestartHint));
+      hud_.survival_stats.set_format(TextUtils::get_text(TextId::SurvivalStats));
+      hud_.survival_stats.set(game_time_, kill_count_);
+      hud_.game_over_language.set(TextUtils::get_text(TextId::LanguageSwitch));
+      hud_.game_over.record(commands);
+      hud_.restart_hint.record(commands);
+      hud_.survival_stats.record(commands);
+      hud_.game_over_language.record(commands);
       break;
     }
 
     case GameState::PLAYING: {
       if (game_time_ < 10.0f) {
-        TextUtils::draw_text_localized("move_controls",
-                                       10, GameConstants::SCREEN_HEIGHT - 80, 16, LIGHTGRAY);
-        TextUtils::draw_text_localized("auto_shoot_hint",
-                                       10, GameConstants::SCREEN_HEIGHT - 60, 16, LIGHTGRAY);
-        TextUtils::draw_text_localized("language_switch",
-                                       10, GameConstants::SCREEN_HEIGHT - 40, 16, LIGHTGRAY);
+        hud_.move_hint.set(TextUtils::get_text(TextId::MoveControls));
+        hud_.shoot_hint.set(TextUtils::get_text(TextId::AutoShootHint));
+        hud_.language_hint.set(TextUtils::get_text(TextId::LanguageSwitch));
+        hud_.move_hint.record(commands);
+        hud_.shoot_hint.record(commands);
+        hud_.language_hint.record(commands);
       }
       break;
     }
@@ -283,66 +460,81 @@ void Game::draw_state_messages() const {
 }
 
 #ifdef _DEBUG
-void Game::draw_debug_info() const {
+void Game::record_debug_info(RenderCommandBuffer &commands, const InputSnapshot &input) {
   if (!show_debug_info_) return;
 
-  constexpr int debug_x = GameConstants::SCREEN_WIDTH - 250;
-  int debug_y = 10;
-  constexpr int line_height = 20;
-
-  TextUtils::draw_text_localized("debug_info", debug_x, debug_y, 16, YELLOW);
-  debug_y += line_height;
-
-  DrawText(TextFormat("%s: %d", TextUtils::get_text("fps"), GetFPS()),
-           debug_x, debug_y, 16, GREEN);
-  debug_y += line_height;
-
-  DrawText(TextFormat("%s: %.3f", TextUtils::get_text("delta"), GetFrameTime()),
-           debug_x, debug_y, 16, GREEN);
-  debug_y += line_height;
-
-  DrawText(TextFormat("%s: %.2f", TextUtils::get_text("spawn_timer"), spawn_timer_),
-           debug_x, debug_y, 16, WHITE);
-  debug_y += line_height;
-
-  DrawText(TextFormat("%s: %.2f", TextUtils::get_text("shoot_timer"), shoot_timer_),
-           debug_x, debug_y, 16, WHITE);
-  debug_y += line_height;
-
-  DrawText(TextFormat("%s: %.2f", TextUtils::get_text("spawn_interval"), spawn_interval_),
-           debug_x, debug_y, 16, ORANGE);
-  debug_y += line_height;
-
-  DrawText(TextFormat("%s: %d", TextUtils::get_text("max_enemies"), get_max_enemies()),
-           debug_x, debug_y, 16, ORANGE);
-  debug_y += line_height;
+  hud_.debug_title.set(TextUtils::get_text(TextId::DebugInfo));
+  hud_.fps.set(TextUtils::get_text(TextId::Fps), input.fps);
+  hud_.delta.set(TextUtils::get_text(TextId::Delta), quantize(input.delta_time, 0.001f));
+  hud_.spawn_timer.set(TextUtils::get_text(TextId::SpawnTimer), quantize(spawn_timer_, 0.01f));
+  hud_.shoot_timer.set(TextUtils::get_text(TextId::ShootTimer), quantize(shoot_timer_, 0.01f));
+  hud_.spawn_interval.set(TextUtils::get_text(TextId::SpawnInterval), spawn_interval_);
+  hud_.max_enemies.set(TextUtils::get_text(TextId::MaxEnemies), get_max_enemies());
+  hud_.visible_culled.set(TextUtils::get_text(TextId::VisibleCulled), visible_objects_, culled_objects_);
+
+  hud_.debug_title.record(commands);
+  hud_.fps.record(commands);
+  hud_.delta.record(commands);
+  hud_.spawn_timer.record(commands);
+  hud_.shoot_timer.record(commands);
+  hud_.spawn_interval.record(commands);
+  hud_.max_enemies.record(commands);
+  hud_.visible_culled.record(commands);
 
   // Показуємо позицію гравця
   if (player_) {
-    auto pos = player_->get_position();
-    DrawText(TextFormat("%s: (%.0f, %.0f)", TextUtils::get_text("player_pos"), pos.x, pos.y),
-             debug_x, debug_y, 16, BLUE);
+    const auto [x, y] = get_player_position();
+    hud_.player_pos.set(TextUtils::get_text(TextId::PlayerPos), std::round(x), std::round(y));
+    hud_.player_pos.record(commands);
   }
 }
 #endif
 
 void Game::run() {
   init();
-  while (!WindowShouldClose()) {
-    update();
+
+  // Головний потік лишається потоком вікна й рендера (GLFW вимагає цього), симуляція — окремо.
+  // Кадр N малюється, поки симуляція рахує кадр N+1
+  simulation_ = std::make_unique<SimulationThread>([this](const InputSnapshot &input) { simulate_frame(input); });
+
+  const RenderBackend &backend = RenderBackend::get();
+  while (!backend.should_close()) {
+    const InputSnapshot input = InputSnapshot::capture();
+    simulation_->wait();
+    sync_frame();
+    simulation_->start(input);
     draw();
   }
 
+  simulation_->stop();
+  simulation_ = nullptr;
   unload();
+  RenderBackend::get().close_window();
 }
 
 void Game::unload() {
-  if (player_) {
-    player_ = nullptr;
-  }
+  transform_system_.clear_entities();
+  collision_system_.clear_entities();
+  enemy_system_.clear_entities();
+  enemy_pool_.clear();
+  bullet_pool_.clear();
+  entity_manager_.clear();
+  player_ = nullptr;
+  primitive_renderer_ = nullptr;
+  render_system_ = nullptr;
+  minimap_ = nullptr;
+
+  RenderBackend::get().set_font(Font{});
+  glyph_atlas_.unload();
+}
 
-  enemies_.clear();
-  bullets_.clear();
+void Game::init_font() {
+  const std::string application_directory = GetApplicationDirectory();
+  const std::string font_path = GlyphAtlas::find_font(application_directory);
+  if (glyph_atlas_.load(font_path, TextUtils::collect_codepoints(), application_directory + "cache/")) {
+    RenderBackend::get().set_font(glyph_atlas_.get_font());
+  }
+  TextUtils::set_ascii_only(!glyph_atlas_.is_loaded());
 }
 
 Vector2 Game::get_random_spawn_position() const {
@@ -391,91 +583,202 @@ void Game::update_difficulty() {
   shoot_interval_ = std::max(0.05f, GameConstants::Gameplay::DEFAULT_SHOOT_INTERVAL - (static_cast<float>(difficulty_level) * 0.02f));
 }
 
-void Game::spawn_enemy() {
-  if (static_cast<int>(enemies_.size()) >= get_max_enemies()) return;
+void Game::create_player() {
+  namespace Player = GameConstants::Player;
+  using namespace Components;
+
+  player_ = entity_manager_.create_entity();
+  player_->add_component<Transform>(WORLD_CENTER);
+  player_->add_component<Health>(Player::MAX_HEALTH);
+  player_->add_component<Sprite>(Player::RADIUS, Player::COLOR);
+  player_->add_component<PlayerControl>(Player::SPEED);
+  auto *collider = player_->add_component<Collider>(Player::RADIUS, CollisionLayer::PLAYER, true);
+  collider->mask = CollisionLayer::ENEMY;
+
+  transform_system_.register_entity(player_);
+  collision_system_.register_entity(player_);
+}
+
+void Game::init_pools() {
+  namespace Bullet = GameConstants::Bullet;
+  using namespace Components;
+
+  enemy_pool_.init(entity_manager_, GameConstants::Performance::MAX_ENEMIES_ABSOLUTE, EnemyFactory::add_enemy_components);
+  enemy_pool_.set_release_callback([this](Entity *entity) { unregister_entity(entity); });
+
+  bullet_pool_.init(entity_manager_, GameConstants::Performance::MAX_BULLETS_ABSOLUTE, [](Entity *bullet) {
+    bullet->add_component<Transform>();
+    bullet->add_component<Sprite>(Bullet::RADIUS, Bullet::COLOR);
+    bullet->add_component<Projectile>(Bullet::DAMAGE, Bullet::MAX_LIFETIME);
+    // Колайдер лише задає форму: кулі перевіряє check_collisions у порядку появи, не CollisionSystem
+    auto *collider = bullet->add_component<Collider>(Bullet::RADIUS, CollisionLayer::BULLET, true);
+    collider->mask = CollisionLayer::ENEMY;
+  });
+  bullet_pool_.set_release_callback([this](Entity *entity) { unregister_entity(entity); });
+
+  enemy_system_.reserve(enemy_pool_.get_capacity());
+  enemy_system_.set_flow_field(&flow_field_);
+  crowd_workers_ = std::make_unique<ThreadPool>();
+  enemy_system_.set_thread_pool(crowd_workers_.get());
+
+  // Системи тримають активні сутності у векторах — резерв під повні пули, щоб і вони не росли в бою
+  const size_t max_entities = enemy_pool_.get_capacity() + bullet_pool_.get_capacity() + 1;
+  transform_system_.reserve(max_entities);
+  collision_system_.reserve(max_entities);
+  enemy_positions_.reserve(enemy_pool_.get_capacity());
+  enemy_grid_.reserve(enemy_pool_.get_capacity());
+}
 
-  auto spawn_pos = get_random_spawn_position();
+void Game::spawn_enemy() {
+  // М'який ліміт росте з рівнем; коли він перевищує місткість пулу, рішення ухвалює політика пулу
+  if (static_cast<int>(enemy_pool_.get_active_count()) >= get_max_enemies()) return;
+
+  const int difficulty_level = static_cast<int>(game_time_ / GameConstants::Gameplay::DIFFICULTY_LEVEL_TIME) + 1;
+  const EnemyType type = EnemyFactory::get_random_type_for_level(difficulty_level);
+  const Vector2 position = get_random_spawn_position();
+  Entity *enemy = enemy_pool_.acquire(get_player_position());
+  if (!enemy) return;
+
+  if (!EnemyFactory::reset_enemy_entity(enemy, type, position)) {
+    enemy_pool_.release(enemy);
+    return;
+  }
 
-  auto new_enemy = std::make_unique<ColoradoBeetle>(spawn_pos);
-  enemies_.push_back(std::move(new_enemy));
+  // Рух ворогів інтегрує EnemySystem, тож у TransformSystem вони не потрапляють
+  enemy_system_.register_entity(enemy);
+  collision_system_.register_entity(enemy);
 }
 
 void Game::spawn_bullet() {
-  if (!player_ || !player_->is_alive()) return;
+  if (!is_player_alive()) return;
 
-  const auto *target = find_nearest_enemy();
+  const Entity *target = find_nearest_enemy();
   if (!target) return;
 
-  auto bullet = std::make_unique<Bullet>(player_->get_position(), target->get_position(), 300.f, 25.f);
+  namespace Bullet = GameConstants::Bullet;
+  using namespace Components;
+
+  const Vector2 start = get_player_position();
+  const Vector2 target_position = target->get_component<Transform>()->position;
+  Vector2 direction = {target_position.x - start.x, target_position.y - start.y};
+  if (const float length = std::sqrt(direction.x * direction.x + direction.y * direction.y); length > 0.f) {
+    direction = {direction.x / length, direction.y / length};
+  } else {
+    // Ціль точно під гравцем — стріляємо вправо
+    direction = {1.f, 0.f};
+  }
+
+  Entity *bullet = bullet_pool_.acquire(start);
+  if (!bullet) return;
 
-  bullets_.push_back(std::move(bullet));
+  auto *transform = bullet->get_component<Transform>();
+  transform->position = start;
+  transform->wake();
+  auto *projectile = bullet->get_component<Projectile>();
+  projectile->lifetime = 0.f;
+  projectile->active = true;
+
+  transform_system_.register_entity(bullet);
+  TransformSystem::set_velocity(bullet, Vector2{direction.x * Bullet::SPEED, direction.y * Bullet::SPEED});
   shoot_timer_ = shoot_interval_;
 }
 
-Enemy *Game::find_nearest_enemy() const {
-  if (enemies_.empty() || !player_) return nullptr;
+Entity *Game::find_nearest_enemy() const {
+  if (enemy_pool_.get_active_count() == 0 || !player_) return nullptr;
 
-  const auto player_pos = player_->get_position();
+  const auto player_pos = get_player_position();
   float min_distance_sq = std::numeric_limits<float>::max();
-  Enemy *nearest = nullptr;
+  Entity *nearest = nullptr;
 
-  for (const auto &e: enemies_) {
-    if (!e || !e->is_alive()) continue;
+  for (Entity *enemy : enemy_pool_.get_active()) {
+    if (!enemy_system_.is_alive(enemy)) continue;
 
-    const auto [x, y] = e->get_position();
+    const auto [x, y] = enemy->get_component<Components::Transform>()->position;
     const float dx = player_pos.x - x;
     const float dy = player_pos.y - y;
 
     if (const float distance = dx * dx + dy * dy; distance < min_distance_sq) {
       min_distance_sq = distance;
-      nearest = e.get();
+      nearest = enemy;
     }
   }
 
   return nearest;
 }
 
-void Game::update_timers() {
-  const auto delta_time = GetFrameTime();
+bool Game::is_player_alive() const {
+  return player_ && player_->get_component<Components::Health>()->is_alive();
+}
+
+Vector2 Game::get_player_position() const {
+  return player_ ? player_->get_component<Components::Transform>()->position : Vector2{0, 0};
+}
+
+void Game::update_player(const InputSnapshot &input) {
+  Vector2 direction = {0.f, 0.f};
+  if (input.is_key_down(KEY_W)) direction.y -= 1.f;
+  if (input.is_key_down(KEY_S)) direction.y += 1.f;
+  if (input.is_key_down(KEY_A)) direction.x -= 1.f;
+  if (input.is_key_down(KEY_D)) direction.x += 1.f;
+
+  if (direction.x != 0.f && direction.y != 0.f) {
+    direction.x *= GameConstants::Player::DIAGONAL_MULTIPLIER;
+    direction.y *= GameConstants::Player::DIAGONAL_MULTIPLIER;
+  }
+
+  const float speed = player_->get_component<Components::PlayerControl>()->speed;
+  TransformSystem::set_velocity(player_, Vector2{direction.x * speed, direction.y * speed});
+}
+
+void Game::update_enemies(const float delta_time) {
+  flow_field_.update(get_player_position());
+  enemy_system_.update(delta_time, get_player_position(), camera_->get_camera_bounds());
+}
 
+void Game::update_bullets(const float delta_time) {
+  for (Entity *bullet : bullet_pool_.get_active()) {
+    auto *projectile = bullet->get_component<Components::Projectile>();
+    projectile->lifetime += delta_time;
+    if (projectile->is_expired()) {
+      projectile->active = false;
+    }
+  }
+}
+
+void Game::update_timers(const float delta_time) {
   spawn_timer_ = std::max(0.f, spawn_timer_ - delta_time);
   shoot_timer_ = std::max(0.f, shoot_timer_ - delta_time);
 }
 
 void Game::restart_game() {
-  player_ = std::make_unique<Player>(Vector2{
-    static_cast<float>(GameConstants::WORLD_WIDTH) / 2.f,
-    static_cast<float>(GameConstants::WORLD_HEIGHT) / 2.f
-  });
-  enemies_.clear();
-  bullets_.clear();
+  clear_entities();
+  create_player();
   spawn_timer_ = spawn_interval_;
   kill_count_ = 0;
   game_time_ = 0.0f;
   shoot_timer_ = 0.0f;
-  state_ = GameState::PLAYING;
   spawn_interval_ = GameConstants::Gameplay::DEFAULT_SPAWN_INTERVAL;
   shoot_interval_ = GameConstants::Gameplay::DEFAULT_SHOOT_INTERVAL;
 
   state_ = GameState::PLAYING;
 }
 
-void Game::handle_input() {
+void Game::handle_input(const InputSnapshot &input) {
   using enum GameState;
-  if (IsKeyPressed(KEY_P)) {
+  if (input.is_key_pressed(KEY_P)) {
     state_ = (state_ == PLAYING) ? PAUSE : PLAYING;
   }
 
-  if (IsKeyPressed(KEY_L)) {
+  if (input.is_key_pressed(KEY_L)) {
     toggle_language();
   }
 
-  if (IsKeyPressed(KEY_R) && state_ == GAMEOVER) {
+  if (input.is_key_pressed(KEY_R) && state_ == GAMEOVER) {
     restart_game();
   }
 #ifdef _DEBUG
   // F1 - toggle debug info
-  if (IsKeyPressed(KEY_F1)) {
+  if (input.is_key_pressed(KEY_F1)) {
     show_debug_info_ = !show_debug_info_;
   }
 #endif
@@ -494,55 +797,97 @@ int Game::get_max_enemies() const {
   return base_max + (difficulty_level * 5);
 }
 
-void Game::check_collisions() {
-  if (!player_ || !player_->is_alive()) return;
-
-  const auto player_bounds = player_->get_bounds();
+void Game::on_collision(const CollisionInfo &info) {
+  // CollisionSystem бачить лише пари гравець-ворог (маски), порядок у парі довільний
+  Entity *enemy = info.entity_a == player_ ? info.entity_b : info.entity_a;
+  if (player_hit_this_frame_ || !is_player_alive() || !enemy_system_.is_alive(enemy)) {
+    return;
+  }
 
-  for (auto &e: enemies_) {
-    if (!e || !e->is_alive()) continue;
+  // Ворог, що дістався гравця, завдає удару і гине
+  auto *player_health = player_->get_component<Components::Health>();
+  const int damage = static_cast<int>(EnemyFactory::get_stats(enemy->get_component<Components::Chaser>()->type)->damage);
+  player_health->current_health = std::max(0, player_health->current_health - damage);
+  enemy_system_.kill(enemy);
+  kill_count_++;
+  player_hit_this_frame_ = true;
+}
 
-    if (CheckCollisionRecs(player_bounds, e->get_bounds())) {
-      player_->take_damage(static_cast<int>(e->get_damage()));
-      e.reset();
-      kill_count_++;
-      break;
-    }
+void Game::check_collisions() {
+  if (!is_player_alive()) return;
+
+  const std::vector<Entity*> &enemies = enemy_pool_.get_active();
+  enemy_positions_.clear();
+  float max_enemy_radius = 0.f;
+  for (const Entity *enemy : enemies) {
+    enemy_positions_.push_back(enemy->get_component<Components::Transform>()->position);
+    max_enemy_radius = std::max(max_enemy_radius, enemy->get_component<Components::Collider>()->radius);
   }
-  for (const auto &b: bullets_) {
-    if (!b || !b->is_active()) continue;
+  enemy_grid_.build(enemy_positions_);
 
-    const auto bullet_bounds = b->get_bounds();
+  // Кожна куля влучає в живого ворога з найменшим індексом серед перетинів — у першого за порядком появи,
+  // як і в повному переборі, тож лічильник убивств не залежить від розкладки сітки
+  for (Entity *bullet : bullet_pool_.get_active()) {
+    auto *projectile = bullet->get_component<Components::Projectile>();
+    if (!projectile->active) continue;
 
-    for (auto &e: enemies_) {
-      if (!e || !e->is_alive()) continue;
+    const Vector2 bullet_position = bullet->get_component<Components::Transform>()->position;
+    const float bullet_radius = bullet->get_component<Components::Collider>()->radius;
 
-      if (CheckCollisionRecs(bullet_bounds, e->get_bounds())) {
-        e->take_damage(b->get_damage());
-        b->deactivate();
+    std::uint32_t hit = std::numeric_limits<std::uint32_t>::max();
+    enemy_grid_.query(bullet_position, bullet_radius + max_enemy_radius, [&](const std::uint32_t index) {
+      if (index >= hit || !enemy_system_.is_alive(enemies[index])) return;
 
-        if (!e->is_alive()) {
-          e.reset();
-          kill_count_++;
-        }
-        break;
+      const float enemy_radius = enemies[index]->get_component<Components::Collider>()->radius;
+      if (CheckCollisionCircles(bullet_position, bullet_radius, enemy_positions_[index], enemy_radius)) {
+        hit = index;
       }
+    });
+    if (hit == std::numeric_limits<std::uint32_t>::max()) continue;
+
+    projectile->active = false;
+    if (enemy_system_.apply_damage(enemies[hit], static_cast<int>(projectile->damage))) {
+      kill_count_++;
     }
   }
 }
 
 void Game::cleanup_dead_objects() {
-  auto dead_enemies = std::remove_if(enemies_.begin(), enemies_.end(), [](auto &e) {
-    return !e || !e->is_alive();
+  constexpr float margin = GameConstants::Bullet::WORLD_MARGIN;
+  for (Entity *bullet : bullet_pool_.get_active()) {
+    const Vector2 position = bullet->get_component<Components::Transform>()->position;
+    if (position.x < -margin || position.x > GameConstants::WORLD_WIDTH + margin ||
+        position.y < -margin || position.y > GameConstants::WORLD_HEIGHT + margin) {
+      bullet->get_component<Components::Projectile>()->active = false;
+    }
+  }
+
+  enemy_pool_.release_if([this](const Entity *enemy) {
+    return !enemy_system_.is_alive(enemy);
   });
-  enemies_.erase(dead_enemies, enemies_.end());
+  bullet_pool_.release_if([](const Entity *bullet) {
+    return !bullet->get_component<Components::Projectile>()->active;
+  });
+}
 
-  auto dead_bullets = std::remove_if(
-    bullets_.begin(),
-    bullets_.end(),
-    [](const std::unique_ptr<Bullet> &bullet) {
-      return !bullet || !bullet->is_active();
-    }
-  );
-  bullets_.erase(dead_bullets, bullets_.end());
+void Game::unregister_entity(Entity *entity) {
+  transform_system_.unregister_entity(entity);
+  collision_system_.unregister_entity(entity);
+  enemy_system_.unregister_entity(entity);
+}
+
+void Game::destroy_entity(Entity *entity) {
+  unregister_entity(entity);
+  entity_manager_.destroy_entity(entity);
+}
+
+void Game::clear_entities() {
+  // Слоти пулів лишаються в менеджері — рестарт не перевиділяє їх
+  enemy_pool_.release_all();
+  bullet_pool_.release_all();
+  if (player_) {
+    destroy_entity(player_);
+    player_ = nullptr;
+  }
+  entity_manager_.cleanup_destroyed_entities();
 }
@@ -0,0 +1,125 @@
+#include "Minimap.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "systems/RenderCommandBuffer.h"
+#include "systems/render/RenderBackend.h"
+
+Minimap::Minimap(const Vector2 world_size, const int size, const int resolution, const float update_rate)
+  : world_size_{world_size}
+  , size_{size}
+  , bins_x_{std::max(1, resolution)}
+  , bins_y_{std::max(1, static_cast<int>(std::round(static_cast<float>(resolution) * world_size.y / world_size.x)))}
+  , update_interval_{1.f / update_rate}
+  , density_(static_cast<size_t>(bins_x_ * bins_y_), 0)
+  , pixels_(static_cast<size_t>(bins_x_ * bins_y_)) {
+}
+
+Minimap::~Minimap() {
+  if (texture_.id != 0) {
+    RenderBackend::get().unload_texture(texture_);
+  }
+}
+
+bool Minimap::tick(const float delta_time) {
+  update_timer_ -= delta_time;
+  if (update_timer_ > 0.f) {
+    return false;
+  }
+
+  // Не накопичуємо борг, якщо кадр був довгим
+  update_timer_ = std::max(update_timer_ + update_interval_, 0.f);
+  return true;
+}
+
+void Minimap::clear_density() {
+  std::ranges::fill(density_, 0);
+}
+
+void Minimap::add_point(const Vector2 world_position) {
+  const int x = std::clamp(static_cast<int>(world_position.x / world_size_.x * static_cast<float>(bins_x_)), 0, bins_x_ - 1);
+  const int y = std::clamp(static_cast<int>(world_position.y / world_size_.y * static_cast<float>(bins_y_)), 0, bins_y_ - 1);
+
+  std::uint16_t &cell = density_[static_cast<size_t>(y * bins_x_ + x)];
+  if (cell < std::numeric_limits<std::uint16_t>::max()) {
+    ++cell;
+  }
+}
+
+void Minimap::refresh() {
+  // Фон складаємо на CPU разом із теплом — так текстура малюється одним квадом без подвійного змішування альфи
+  constexpr Color background = {0, 0, 0, 179};
+
+  for (size_t i = 0; i < density_.size(); ++i) {
+    if (density_[i] == 0) {
+      pixels_[i] = background;
+      continue;
+    }
+
+    const float heat = std::min(1.f, static_cast<float>(density_[i]) / DENSITY_SATURATION);
+    const float heat_alpha = 0.45f + 0.55f * heat;
+
+    // Оператор "over": тепло поверх чорного фону, результат у звичайній (непремноженій) альфі
+    const float background_alpha = static_cast<float>(background.a) / 255.f;
+    const float out_alpha = heat_alpha + background_alpha * (1.f - heat_alpha);
+    const float brightness = heat_alpha / out_alpha;
+
+    pixels_[i] = {
+      static_cast<unsigned char>(255.f * brightness),
+      static_cast<unsigned char>(200.f * heat * brightness),
+      0,
+      static_cast<unsigned char>(255.f * out_alpha)
+    };
+  }
+
+  pixels_dirty_ = true;
+}
+
+void Minimap::upload() {
+  if (!pixels_dirty_) {
+    return;
+  }
+  pixels_dirty_ = false;
+
+  RenderBackend &backend = RenderBackend::get();
+  if (texture_.id == 0) {
+    const Image image = {pixels_.data(), bins_x_, bins_y_, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+    texture_ = backend.load_texture(image);
+    backend.set_texture_filter(texture_, TEXTURE_FILTER_BILINEAR);
+  } else {
+    backend.update_texture(texture_, pixels_.data());
+  }
+}
+
+void Minimap::record(RenderCommandBuffer &commands, const Vector2 screen_position, const Vector2 player_position,
+                     const Rectangle &camera_bounds) const {
+  const auto size = static_cast<float>(size_);
+  const float scale_x = size / world_size_.x;
+  const float scale_y = size / world_size_.y;
+
+  if (texture_.id != 0) {
+    commands.add_texture(texture_,
+                         Rectangle{0, 0, static_cast<float>(bins_x_), static_cast<float>(bins_y_)},
+                         Rectangle{screen_position.x, screen_position.y, size, size},
+                         WHITE);
+  }
+  commands.add_rect_lines(Rectangle{screen_position.x, screen_position.y, size, size}, WHITE);
+
+  commands.add_circle({
+                        std::floor(screen_position.x + player_position.x * scale_x),
+                        std::floor(screen_position.y + player_position.y * scale_y)
+                      }, 3.f, BLUE);
+
+  commands.add_rect_lines(Rectangle{
+                            std::floor(screen_position.x + camera_bounds.x * scale_x),
+                            std::floor(screen_position.y + camera_bounds.y * scale_y),
+                            std::floor(camera_bounds.width * scale_x),
+                            std::floor(camera_bounds.height * scale_y)
+                          }, YELLOW);
+}
+
+void Minimap::set_update_rate(const float update_rate) {
+  update_interval_ = 1.f / update_rate;
+}
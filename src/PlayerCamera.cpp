@@ -15,9 +15,7 @@ PlayerCamera::PlayerCamera(Vector2 screen_size, Vector2 world_size, float follow
   camera_.zoom = 1.f;
 }
 
-void PlayerCamera::update(Vector2 target_pos) {
-  const auto delta_time = GetFrameTime();
-
+void PlayerCamera::update(Vector2 target_pos, const float delta_time) {
   Vector2 desired_target = target_pos;
 
   camera_.target.x += (desired_target.x - camera_.target.x) * follow_speed_ * delta_time;
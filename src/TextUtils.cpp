@@ -1,175 +1,276 @@
 #include "TextUtils.h"
+#include <algorithm>
 #include <iostream>
+#include <utility>
+
+#include "systems/render/RenderBackend.h"
+
+namespace {
+
+using LocalizationFormat::hash_key;
+
+// Порядок рядків збігається з TextId.
+// Літерали закінчуються нулем, тож data() можна віддавати як C-рядок
+constexpr std::array<std::string_view, TEXT_ID_COUNT> KEYS = {
+    "health", "killed", "time", "enemies", "bullets", "seconds",
+    "paused", "game_over", "game_title",
+    "restart_hint", "continue_hint", "move_controls", "auto_shoot_hint", "language_switch",
+    "game_start", "enemy_spawn", "hit_target", "enemy_killed", "player_damaged", "game_restart",
+    "difficulty_increase", "survival_stats", "spawn_rate",
+    "debug_info", "fps", "delta", "spawn_timer", "shoot_timer", "spawn_interval", "max_enemies",
+    "visible_culled", "player_pos",
+};
+
+constexpr std::array<std::uint32_t, TEXT_ID_COUNT> KEY_HASHES = [] {
+    std::array<std::uint32_t, TEXT_ID_COUNT> hashes{};
+    for (size_t i = 0; i < TEXT_ID_COUNT; ++i) {
+        hashes[i] = hash_key(KEYS[i]);
+    }
+    return hashes;
+}();
 
-// Ініціалізація статичних членів
-std::unordered_map<std::string, std::unordered_map<Language, std::string>> TextUtils::translations_;
-Language TextUtils::current_language_ = Language::English;
-
-void TextUtils::init_translations() {
-    std::cout << "Initializing localization system..." << std::endl;
-
+// Вбудована англійська — фолбек, коли каталогу немає або в ньому бракує рядка.
+// Переклади живуть у assets/lang/*.lang і компілюються в .bloc під час збірки
+constexpr std::array<std::string_view, TEXT_ID_COUNT> FALLBACK_TEXTS = {
     // UI Elements
-    translations_["health"][Language::English] = "HP";
-    translations_["health"][Language::Ukrainian] = "ZD"; // Здоров'я (скорочено для ASCII)
-
-    translations_["killed"][Language::English] = "Killed";
-    translations_["killed"][Language::Ukrainian] = "Vbyto";
-
-    translations_["time"][Language::English] = "Time";
-    translations_["time"][Language::Ukrainian] = "Chas";
-
-    translations_["enemies"][Language::English] = "Enemies";
-    translations_["enemies"][Language::Ukrainian] = "Vorogiv";
-
-    translations_["bullets"][Language::English] = "Bullets";
-    translations_["bullets"][Language::Ukrainian] = "Kul";
-
-    translations_["seconds"][Language::English] = "sec";
-    translations_["seconds"][Language::Ukrainian] = "sek";
-
+    "HP", "Killed", "Time", "Enemies", "Bullets", "sec",
     // Game States
-    translations_["paused"][Language::English] = "PAUSED";
-    translations_["paused"][Language::Ukrainian] = "PAUZA";
-
-    translations_["game_over"][Language::English] = "GAME OVER";
-    translations_["game_over"][Language::Ukrainian] = "KINEC GRY";
-
-    translations_["game_title"][Language::English] = "BULBYK: TO THE ROOT OF EVIL";
-    translations_["game_title"][Language::Ukrainian] = "BULBYK: DO KORENYA ZLA";
-
+    "PAUSED", "GAME OVER", "BULBYK: TO THE ROOT OF EVIL",
     // Controls
-    translations_["restart_hint"][Language::English] = "R - restart";
-    translations_["restart_hint"][Language::Ukrainian] = "R - restart";
-
-    translations_["continue_hint"][Language::English] = "ESC - continue";
-    translations_["continue_hint"][Language::Ukrainian] = "ESC - prodovzhyty";
-
-    translations_["move_controls"][Language::English] = "WASD - move, ESC - pause";
-    translations_["move_controls"][Language::Ukrainian] = "WASD - rukh, ESC - pauza";
-
-    translations_["auto_shoot_hint"][Language::English] = "Auto-shoot at nearest enemy";
-    translations_["auto_shoot_hint"][Language::Ukrainian] = "Avtostrilba v nayblyzhchoho voroga";
-
-    translations_["language_switch"][Language::English] = "L - switch language";
-    translations_["language_switch"][Language::Ukrainian] = "L - zminyty movu";
-
+    "R - restart", "ESC - continue", "WASD - move, ESC - pause", "Auto-shoot at nearest enemy",
+    "L - switch language",
     // Game Messages
-    translations_["game_start"][Language::English] = "Bulbyk begins his journey!";
-    translations_["game_start"][Language::Ukrainian] = "Bulbyk pochynaye svoyu podorozh!";
+    "Bulbyk begins his journey!", "New enemy appeared! Total", "Hit!", "Enemy destroyed! Total",
+    "Bulbyk took damage!", "Game restarted!", "Difficulty level",
+    // Stats Format Strings (для sprintf-like форматування)
+    "You survived %.1f seconds and killed %d enemies", "spawn rate",
+    // Debug Info
+    "=== DEBUG INFO ===", "FPS", "Delta", "Spawn Timer", "Shoot Timer", "Spawn Interval", "Max Enemies",
+    "Visible / Culled", "Player",
+};
+
+// Основний каталог і транслітерований на випадок шрифту без кирилиці
+struct CatalogCodes {
+    const char* code;
+    const char* ascii_code;
+};
+
+constexpr std::array<CatalogCodes, LANGUAGE_COUNT> CATALOG_CODES = {{
+    {"en", "en"},
+    {"uk", "uk_latn"},
+}};
+
+constexpr int ASCII_FIRST = 32;
+constexpr int ASCII_LAST = 126;
+
+void add_codepoints(const std::string_view text, std::vector<int> &codepoints) {
+    for (size_t i = 0; i < text.size();) {
+        // Нулі розділяють рядки в blob каталогу
+        if (text[i] == '\0') {
+            ++i;
+            continue;
+        }
+        int size = 0;
+        const int codepoint = GetCodepointNext(text.data() + i, &size);
+        if (codepoint > ASCII_LAST) {
+            codepoints.push_back(codepoint);
+        }
+        i += static_cast<size_t>(std::max(size, 1));
+    }
+}
 
-    translations_["enemy_spawn"][Language::English] = "New enemy appeared! Total";
-    translations_["enemy_spawn"][Language::Ukrainian] = "Novyy vorog z'yavyvsya! Vsogo";
+static_assert(KEYS.back() == "player_pos", "KEYS must follow TextId order");
+static_assert(!FALLBACK_TEXTS.back().empty(), "FALLBACK_TEXTS must have a row for every TextId");
 
-    translations_["hit_target"][Language::English] = "Hit!";
-    translations_["hit_target"][Language::Ukrainian] = "Vluchannya!";
+const char* get_language_name(const Language lang) {
+    return lang == Language::English ? "English" : "Ukrainian";
+}
 
-    translations_["enemy_killed"][Language::English] = "Enemy destroyed! Total";
-    translations_["enemy_killed"][Language::Ukrainian] = "Vorog znyshchenyy! Vsogo";
+} // namespace
 
-    translations_["player_damaged"][Language::English] = "Bulbyk took damage!";
-    translations_["player_damaged"][Language::Ukrainian] = "Bulbyk otrymav poshkodzhennya!";
+// Ініціалізація статичних членів
+std::array<LocalizationCatalog, LANGUAGE_COUNT> TextUtils::catalogs_;
+std::vector<LocalizationCatalog> TextUtils::retired_catalogs_;
+std::array<bool, LANGUAGE_COUNT> TextUtils::catalog_requested_{};
+std::array<std::array<const char*, TEXT_ID_COUNT>, LANGUAGE_COUNT> TextUtils::resolved_{};
+std::string TextUtils::catalog_directory_;
+bool TextUtils::ascii_only_ = false;
+std::unordered_map<std::string, std::array<std::string, LANGUAGE_COUNT>> TextUtils::dynamic_translations_;
+Language TextUtils::current_language_ = Language::English;
 
-    translations_["game_restart"][Language::English] = "Game restarted!";
-    translations_["game_restart"][Language::Ukrainian] = "Gra perezapushchena!";
+void TextUtils::init_translations(const std::string& catalog_directory) {
+    std::cout << "Initializing localization system..." << std::endl;
 
-    translations_["difficulty_increase"][Language::English] = "Difficulty level";
-    translations_["difficulty_increase"][Language::Ukrainian] = "Riven skladnosti";
+    catalog_directory_ = catalog_directory.empty()
+        ? std::string(GetApplicationDirectory()) + "lang/"
+        : catalog_directory;
+    if (catalog_directory_.back() != '/' && catalog_directory_.back() != '\\') {
+        catalog_directory_.push_back('/');
+    }
 
-    // Stats Format Strings (для sprintf-like форматування)
-    translations_["survival_stats"][Language::English] = "You survived %.1f seconds and killed %d enemies";
-    translations_["survival_stats"][Language::Ukrainian] = "Ty protrymalsya %.1f sekund i vbyv %d vorogiv";
+    // Повторна ініціалізація (інша тека) перевідкриває каталоги при наступному зверненні
+    catalog_requested_.fill(false);
+    ensure_catalog(current_language_);
 
-    translations_["spawn_rate"][Language::English] = "spawn rate";
-    translations_["spawn_rate"][Language::Ukrainian] = "shvydkist spawn";
+    std::cout << "Localization initialized! Language: " << get_language_name(current_language_) << std::endl;
+}
 
-    // Debug Info
-    translations_["debug_info"][Language::English] = "=== DEBUG INFO ===";
-    translations_["debug_info"][Language::Ukrainian] = "=== DEBUG INFO ===";
+void TextUtils::set_language(Language lang) {
+    current_language_ = lang;
+    ensure_catalog(lang);
+    std::cout << "Language changed to: " << get_language_name(lang) << std::endl;
+}
 
-    translations_["fps"][Language::English] = "FPS";
-    translations_["fps"][Language::Ukrainian] = "FPS";
+void TextUtils::ensure_catalog(const Language lang) {
+    const auto index = static_cast<size_t>(lang);
+    if (catalog_requested_[index]) {
+        return;
+    }
+    catalog_requested_[index] = true;
 
-    translations_["delta"][Language::English] = "Delta";
-    translations_["delta"][Language::Ukrainian] = "Delta";
+    // Відображення без розбору: лише бінарний пошук кожного TextId у відсортованій таблиці
+    LocalizationCatalog &catalog = catalogs_[index];
+    if (catalog.is_loaded()) {
+        // Старі рядки ще можуть тримати викликачі — відображення лишається живим
+        retired_catalogs_.push_back(std::exchange(catalog, LocalizationCatalog{}));
+    }
+    catalog.open(get_catalog_path(lang, ascii_only_));
+    for (size_t i = 0; i < TEXT_ID_COUNT; ++i) {
+        resolved_[index][i] = catalog.is_loaded() ? catalog.find(KEY_HASHES[i]) : nullptr;
+    }
+}
 
-    translations_["spawn_timer"][Language::English] = "Spawn Timer";
-    translations_["spawn_timer"][Language::Ukrainian] = "Spawn Timer";
+Language TextUtils::get_current_language() {
+    return current_language_;
+}
 
-    translations_["shoot_timer"][Language::English] = "Shoot Timer";
-    translations_["shoot_timer"][Language::Ukrainian] = "Shoot Timer";
+void TextUtils::set_ascii_only(const bool ascii_only) {
+    if (ascii_only_ == ascii_only) {
+        return;
+    }
+    ascii_only_ = ascii_only;
+    catalog_requested_.fill(false);
+    ensure_catalog(current_language_);
+}
 
-    translations_["spawn_interval"][Language::English] = "Spawn Interval";
-    translations_["spawn_interval"][Language::Ukrainian] = "Spawn Interval";
+bool TextUtils::is_ascii_only() {
+    return ascii_only_;
+}
 
-    translations_["max_enemies"][Language::English] = "Max Enemies";
-    translations_["max_enemies"][Language::Ukrainian] = "Max Enemies";
+std::vector<int> TextUtils::collect_codepoints() {
+    std::vector<int> codepoints;
+    for (int codepoint = ASCII_FIRST; codepoint <= ASCII_LAST; ++codepoint) {
+        codepoints.push_back(codepoint);
+    }
 
-    translations_["player_pos"][Language::English] = "Player";
-    translations_["player_pos"][Language::Ukrainian] = "Player";
+    // Основні каталоги відкриваються тимчасово: транслітерований варіант міг бути вже активним
+    for (size_t i = 0; i < LANGUAGE_COUNT; ++i) {
+        LocalizationCatalog catalog;
+        if (catalog.open(get_catalog_path(static_cast<Language>(i), false))) {
+            add_codepoints(catalog.get_blob(), codepoints);
+        }
+    }
+    for (const std::string_view text : FALLBACK_TEXTS) {
+        add_codepoints(text, codepoints);
+    }
+    for (const auto &[key, texts] : dynamic_translations_) {
+        for (const std::string &text : texts) {
+            add_codepoints(text, codepoints);
+        }
+    }
 
-    std::cout << "Localization initialized! Language: "
-              << (current_language_ == Language::English ? "English" : "Ukrainian")
-              << std::endl;
+    std::ranges::sort(codepoints);
+    const auto duplicates = std::ranges::unique(codepoints);
+    codepoints.erase(duplicates.begin(), duplicates.end());
+    return codepoints;
 }
 
-void TextUtils::set_language(Language lang) {
-    current_language_ = lang;
-    std::cout << "Language changed to: "
-              << (lang == Language::English ? "English" : "Ukrainian")
-              << std::endl;
+std::string TextUtils::get_catalog_path(const Language lang, const bool ascii_only) {
+    const CatalogCodes &codes = CATALOG_CODES[static_cast<size_t>(lang)];
+    return catalog_directory_ + (ascii_only ? codes.ascii_code : codes.code) + ".bloc";
 }
 
-Language TextUtils::get_current_language() {
-    return current_language_;
+const char* TextUtils::get_text(const TextId id) {
+    return get_text(id, current_language_);
 }
 
-const char* TextUtils::get_text(const std::string& key) {
-    auto key_it = translations_.find(key);
-    if (key_it == translations_.end()) {
-        std::cerr << "Warning: Translation key '" << key << "' not found!" << std::endl;
-        return key.c_str(); // Повертаємо сам ключ як fallback
+const char* TextUtils::get_text(const TextId id, const Language lang) {
+    ensure_catalog(lang);
+    const char* text = resolved_[static_cast<size_t>(lang)][static_cast<size_t>(id)];
+    // Якщо немає перекладу для мови, беремо вбудовану англійську
+    return text ? text : FALLBACK_TEXTS[static_cast<size_t>(id)].data();
+}
+
+const char* TextUtils::get_text(const std::string_view key) {
+    if (TextId id; find_id(key, &id)) {
+        return get_text(id);
     }
 
-    auto lang_it = key_it->second.find(current_language_);
-    if (lang_it == key_it->second.end()) {
-        // Якщо немає перекладу для поточної мови, пробуємо англійську
-        auto en_it = key_it->second.find(Language::English);
-        if (en_it != key_it->second.end()) {
-            return en_it->second.c_str();
-        }
+    // Каталог може містити ключі, яких немає в TextId
+    ensure_catalog(current_language_);
+    if (const char* text = catalogs_[static_cast<size_t>(current_language_)].find(key)) {
+        return text;
+    }
 
-        std::cerr << "Warning: No translation for key '" << key
-                  << "' in current language!" << std::endl;
-        return key.c_str();
+    const auto it = dynamic_translations_.find(std::string(key));
+    if (it == dynamic_translations_.end()) {
+        std::cerr << "Warning: Translation key '" << key << "' not found!" << std::endl;
+        // Запам'ятовуємо сам ключ як fallback — повернений вказівник лишається дійсним
+        auto &texts = dynamic_translations_[std::string(key)];
+        texts[static_cast<size_t>(Language::English)] = key;
+        return texts[static_cast<size_t>(Language::English)].c_str();
     }
 
-    return lang_it->second.c_str();
+    const std::string &text = it->second[static_cast<size_t>(current_language_)];
+    return text.empty() ? it->second[static_cast<size_t>(Language::English)].c_str() : text.c_str();
+}
+
+std::string_view TextUtils::get_key(const TextId id) {
+    return KEYS[static_cast<size_t>(id)];
 }
 
-std::string TextUtils::get_formatted_text(const std::string& key, const std::string& format_args) {
+std::string TextUtils::get_formatted_text(const std::string_view key, const std::string& format_args) {
     // Для складного форматування можна використовувати std::format (C++20)
     // Поки що повертаємо базовий текст
     return std::string(get_text(key));
 }
 
-void TextUtils::draw_text_localized(const std::string& key, int x, int y, int size, Color color) {
-    DrawText(get_text(key), x, y, size, color);
+void TextUtils::draw_text_localized(const TextId id, int x, int y, int size, Color color) {
+    RenderBackend::get().draw_text(get_text(id), x, y, size, color);
 }
 
-void TextUtils::draw_text_centered(const std::string& key, int center_x, int y, int size, Color color) {
-    const char* text = get_text(key);
-    int text_width = MeasureText(text, size);
-    DrawText(text, center_x - text_width/2, y, size, color);
+void TextUtils::draw_text_centered(const TextId id, int center_x, int y, int size, Color color) {
+    RenderBackend &backend = RenderBackend::get();
+    const char* text = get_text(id);
+    int text_width = backend.measure_text(text, size);
+    backend.draw_text(text, center_x - text_width/2, y, size, color);
 }
 
-int TextUtils::get_text_width(const std::string& key, int font_size) {
-    return MeasureText(get_text(key), font_size);
+int TextUtils::get_text_width(const TextId id, int font_size) {
+    return RenderBackend::get().measure_text(get_text(id), font_size);
 }
 
-bool TextUtils::has_translation(const std::string& key) {
-    return translations_.find(key) != translations_.end();
+bool TextUtils::has_translation(const std::string_view key) {
+    TextId id;
+    ensure_catalog(current_language_);
+    return find_id(key, &id) || catalogs_[static_cast<size_t>(current_language_)].find(key)
+        || dynamic_translations_.contains(std::string(key));
 }
 
 void TextUtils::add_translation(const std::string& key, Language lang, const std::string& text) {
-    translations_[key][lang] = text;
+    if (TextId id; find_id(key, &id)) {
+        std::cerr << "Warning: Key '" << key << "' is built in and can't be overridden!" << std::endl;
+        return;
+    }
+    dynamic_translations_[key][static_cast<size_t>(lang)] = text;
+}
+
+bool TextUtils::find_id(const std::string_view key, TextId* out_id) {
+    for (size_t i = 0; i < TEXT_ID_COUNT; ++i) {
+        if (KEYS[i] == key) {
+            *out_id = static_cast<TextId>(i);
+            return true;
+        }
+    }
+    return false;
 }
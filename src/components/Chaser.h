@@ -0,0 +1,33 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include "../core/Entity.h"
+
+enum class EnemyType {
+  ColoradoBeetle,
+  Aphid,
+  Wireworm,
+  MoleCricket,
+  Cutworm
+};
+
+constexpr size_t ENEMY_TYPE_COUNT = 5;
+
+namespace Components {
+
+// Ворог під керуванням EnemySystem: рух, перезарядка і здоров'я лежать у SoA-пачці його типу,
+// тут — лише адреса в ній. batch_index підтримує сама система
+struct Chaser final : public Component {
+  static constexpr std::uint32_t NO_BATCH = UINT32_MAX;
+
+  EnemyType type = EnemyType::ColoradoBeetle;
+  std::uint32_t batch_index = NO_BATCH;
+
+  Chaser() = default;
+
+  explicit Chaser(const EnemyType type) : type(type) {
+  }
+};
+
+} // namespace Components
@@ -8,7 +8,10 @@
 namespace Components {
   enum class ColliderType {
     CIRCLE,
-    RECTANGLE
+    RECTANGLE,      // AABB, Transform::rotation ігнорується
+    ORIENTED_BOX,   // прямокутник, повернутий на Transform::rotation
+    CAPSULE,        // відрізок 2 * half_length вздовж локальної осі X, товщина radius
+    COUNT
   };
 
   enum class CollisionLayer : unsigned int {
@@ -40,6 +43,7 @@ namespace Components {
 
     Vector2 offset = {0.0f, 0.0f};
     Vector2 size = {20.0f, 20.0f};
+    float half_length = 0.0f;
 
     CollisionLayer collisionLayer = CollisionLayer::NONE;
     CollisionLayer mask = CollisionLayer::ALL;
@@ -63,5 +67,13 @@ namespace Components {
         , collisionLayer(layer_type)
         , is_trigger(trigger) {
     }
+
+    Collider(float r, float half_len, CollisionLayer layer_type, bool trigger = false)
+      : type(ColliderType::CAPSULE)
+        , radius(r)
+        , half_length(half_len)
+        , collisionLayer(layer_type)
+        , is_trigger(trigger) {
+    }
   };
 }
@@ -0,0 +1,16 @@
+#pragma once
+#include "../core/Entity.h"
+
+namespace Components {
+
+// Entity, яким керує гравець з клавіатури (WASD)
+struct PlayerControl final : public Component {
+  float speed = 200.f;
+
+  PlayerControl() = default;
+
+  explicit PlayerControl(const float speed) : speed(speed) {
+  }
+};
+
+} // namespace Components
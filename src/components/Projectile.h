@@ -0,0 +1,20 @@
+#pragma once
+#include "../core/Entity.h"
+
+namespace Components {
+
+struct Projectile final : public Component {
+  float damage = 0.f;
+  float lifetime = 0.f;
+  float max_lifetime = 5.f;
+  bool active = true;
+
+  Projectile() = default;
+
+  Projectile(const float damage, const float max_lifetime) : damage(damage), max_lifetime(max_lifetime) {
+  }
+
+  bool is_expired() const { return lifetime >= max_lifetime; }
+};
+
+} // namespace Components
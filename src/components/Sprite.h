@@ -1,11 +1,12 @@
 #pragma once
 #include "raylib.h"
 #include "../core/Entity.h"
+#include "../core/TextureRegistry.h"
 
 namespace Components {
 
 struct Sprite : Component {
-  std::string texture_name = "";
+  TextureHandle texture = TextureRegistry::PLACEHOLDER;
   Rectangle source_rect = {0, 0, 0, 0};
   Vector2 origin = {0.5f, 0.5f};
   Color tint = WHITE;
@@ -18,7 +19,10 @@ struct Sprite : Component {
 
   Sprite() = default;
 
-  explicit Sprite(const std::string &texture_name) : texture_name(texture_name), use_primitive(false) {
+  explicit Sprite(const std::string &texture_name) : texture(TextureRegistry::intern(texture_name)), use_primitive(false) {
+  }
+
+  explicit Sprite(const TextureHandle texture_handle) : texture(texture_handle), use_primitive(false) {
   }
 
   Sprite(const float radius, const Color color) : use_primitive(true), primitive_radius(radius), primitive_color(color)  {
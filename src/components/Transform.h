@@ -9,6 +9,10 @@ namespace Components {
     Vector2 scale = {1.0f, 1.0f};
     Vector2 velocity = {0.0f, 0.0f};
 
+    // Стан сну керується TransformSystem; CollisionSystem лише читає його
+    bool sleeping = false;
+    unsigned int rest_frames = 0;
+
     Transform() = default;
 
     explicit Transform(const Vector2 position) : position(position) {
@@ -20,5 +24,12 @@ namespace Components {
     Transform(const Vector2 position, const float rotation, const Vector2 scale) : position(position),
       rotation(rotation), scale(scale) {
     }
+
+    bool is_at_rest() const { return velocity.x == 0.0f && velocity.y == 0.0f; }
+
+    void wake() {
+      sleeping = false;
+      rest_frames = 0;
+    }
   };
 } // namespace Components
@@ -0,0 +1,49 @@
+#include "DenseGrid.h"
+
+#include <cmath>
+
+DenseGrid::DenseGrid(const Rectangle bounds, const float cell_size)
+  : bounds_(bounds)
+  , cell_size_(std::max(1.f, cell_size))
+  , columns_(std::max(1, static_cast<int>(std::ceil(bounds.width / cell_size_))))
+  , rows_(std::max(1, static_cast<int>(std::ceil(bounds.height / cell_size_))))
+  , cell_start_(static_cast<size_t>(columns_) * rows_ + 1, 0) {
+}
+
+void DenseGrid::build(const std::vector<Vector2> &positions) {
+  std::ranges::fill(cell_start_, 0u);
+  item_cells_.resize(positions.size());
+  items_.resize(positions.size());
+
+  // Підрахунок: cell_start_[c + 1] — кількість точок у клітинці c
+  for (size_t i = 0; i < positions.size(); ++i) {
+    const std::uint32_t cell = row_of(positions[i].y) * columns_ + column_of(positions[i].x);
+    item_cells_[i] = cell;
+    ++cell_start_[cell + 1];
+  }
+
+  for (size_t c = 1; c < cell_start_.size(); ++c) {
+    cell_start_[c] += cell_start_[c - 1];
+  }
+
+  // Стабільне розкладання: у кожній клітинці індекси йдуть за зростанням.
+  // cell_start_[c] тимчасово служить курсором запису і після проходу зсувається на початок c + 1
+  for (size_t i = 0; i < positions.size(); ++i) {
+    items_[cell_start_[item_cells_[i]]++] = static_cast<std::uint32_t>(i);
+  }
+  for (size_t c = cell_start_.size() - 1; c > 0; --c) {
+    cell_start_[c] = cell_start_[c - 1];
+  }
+  cell_start_[0] = 0;
+}
+
+void DenseGrid::clear() {
+  std::ranges::fill(cell_start_, 0u);
+  items_.clear();
+  item_cells_.clear();
+}
+
+void DenseGrid::reserve(const size_t item_count) {
+  items_.reserve(item_count);
+  item_cells_.reserve(item_count);
+}
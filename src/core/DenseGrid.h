@@ -0,0 +1,74 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "raylib.h"
+
+// Щільна рівномірна сітка точок у фіксованих межах, що перебудовується щокадру сортуванням підрахунком.
+// Точки поза межами потрапляють у крайні клітинки, тож запити біля краю їх не гублять.
+// Елементи клітинки лежать за зростанням індексу; буфери переживають кадри — у сталому режимі без виділень
+class DenseGrid {
+private:
+  Rectangle bounds_;
+  float cell_size_;
+  int columns_;
+  int rows_;
+
+  // Елементи клітинки c — items_[cell_start_[c] .. cell_start_[c + 1])
+  std::vector<std::uint32_t> cell_start_;
+  std::vector<std::uint32_t> items_;
+  std::vector<std::uint32_t> item_cells_;
+
+public:
+  DenseGrid(Rectangle bounds, float cell_size);
+
+  // Розкладає positions[i] по клітинках; індекс точки — i
+  void build(const std::vector<Vector2> &positions);
+  void clear();
+  void reserve(size_t item_count);
+
+  // Викликає visit(index) для кожної точки з клітинок, що перетинають коло (center, radius).
+  // Порядок — по клітинках, тож найменший індекс серед влучань шукає сам викликач.
+  // Якщо visit повертає bool, false зупиняє обхід
+  template<typename Visitor>
+  void query(const Vector2 center, const float radius, Visitor &&visit) const {
+    if (items_.empty()) {
+      return;
+    }
+
+    const int x0 = column_of(center.x - radius);
+    const int x1 = column_of(center.x + radius);
+    const int y0 = row_of(center.y - radius);
+    const int y1 = row_of(center.y + radius);
+
+    for (int y = y0; y <= y1; ++y) {
+      for (int x = x0; x <= x1; ++x) {
+        const int cell = y * columns_ + x;
+        for (std::uint32_t i = cell_start_[cell]; i < cell_start_[cell + 1]; ++i) {
+          if constexpr (std::is_same_v<std::invoke_result_t<Visitor&, std::uint32_t>, bool>) {
+            if (!visit(items_[i])) {
+              return;
+            }
+          } else {
+            visit(items_[i]);
+          }
+        }
+      }
+    }
+  }
+
+  float get_cell_size() const { return cell_size_; }
+  int get_columns() const { return columns_; }
+  int get_rows() const { return rows_; }
+  size_t get_item_count() const { return items_.size(); }
+
+private:
+  int column_of(const float x) const {
+    return std::clamp(static_cast<int>((x - bounds_.x) / cell_size_), 0, columns_ - 1);
+  }
+  int row_of(const float y) const {
+    return std::clamp(static_cast<int>((y - bounds_.y) / cell_size_), 0, rows_ - 1);
+  }
+};
@@ -0,0 +1,103 @@
+#include "EntityPool.h"
+
+#include <algorithm>
+
+#include "EntityManager.h"
+#include "utils.h"
+#include "components/Transform.h"
+
+const char *to_string(const PoolOverflowPolicy policy) {
+  switch (policy) {
+    case PoolOverflowPolicy::DROP_NEW: return "DropNew";
+    case PoolOverflowPolicy::DROP_OLDEST: return "DropOldest";
+    case PoolOverflowPolicy::RECYCLE_FARTHEST: return "RecycleFarthest";
+  }
+  return "Unknown";
+}
+
+EntityPool::EntityPool(const PoolOverflowPolicy policy) : policy_(policy) {
+}
+
+void EntityPool::init(EntityManager &manager, const size_t capacity, const Builder &build) {
+  clear();
+  capacity_ = capacity;
+  free_.reserve(capacity);
+  active_.reserve(capacity);
+
+  for (size_t i = 0; i < capacity; ++i) {
+    Entity *entity = manager.create_entity();
+    build(entity);
+    free_.push_back(entity);
+  }
+  // Стек: перший acquire віддає перший створений слот
+  std::ranges::reverse(free_);
+}
+
+Entity* EntityPool::acquire(const Vector2 reference) {
+  if (free_.empty()) {
+    ++overflow_count_;
+    Entity *victim = select_victim(reference);
+    if (!victim) {
+      return nullptr;
+    }
+    release(victim);
+  }
+
+  Entity *entity = free_.back();
+  free_.pop_back();
+  active_.push_back(entity);
+  return entity;
+}
+
+void EntityPool::release(Entity *entity) {
+  const auto it = std::ranges::find(active_, entity);
+  if (it == active_.end()) {
+    TRACELOG(LOG_WARNING, "EntityPool: entity %d is not active in this pool", entity ? entity->get_id() : 0);
+    return;
+  }
+
+  active_.erase(it);
+  free_.push_back(entity);
+  if (on_release_) {
+    on_release_(entity);
+  }
+}
+
+void EntityPool::release_all() {
+  release_if([](const Entity*) { return true; });
+}
+
+void EntityPool::clear() {
+  free_.clear();
+  active_.clear();
+  capacity_ = 0;
+  overflow_count_ = 0;
+}
+
+Entity* EntityPool::select_victim(const Vector2 reference) const {
+  if (active_.empty()) {
+    return nullptr;
+  }
+
+  switch (policy_) {
+    case PoolOverflowPolicy::DROP_NEW:
+      return nullptr;
+    case PoolOverflowPolicy::DROP_OLDEST:
+      return active_.front();
+    case PoolOverflowPolicy::RECYCLE_FARTHEST: {
+      Entity *farthest = nullptr;
+      float max_distance_sq = -1.f;
+      for (Entity *entity : active_) {
+        const Vector2 position = entity->get_component<Components::Transform>()->position;
+        const float dx = position.x - reference.x;
+        const float dy = position.y - reference.y;
+        if (const float distance_sq = dx * dx + dy * dy; distance_sq > max_distance_sq) {
+          max_distance_sq = distance_sq;
+          farthest = entity;
+        }
+      }
+      return farthest;
+    }
+  }
+  return nullptr;
+}
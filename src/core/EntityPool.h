@@ -0,0 +1,87 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "raylib.h"
+
+class Entity;
+class EntityManager;
+
+// Що робити із запитом, коли всі слоти пулу зайняті
+enum class PoolOverflowPolicy {
+  DROP_NEW,          // новий об'єкт не з'являється
+  DROP_OLDEST,       // звільняється найстаріший активний
+  RECYCLE_FARTHEST   // звільняється найдальший від опорної точки
+};
+
+const char *to_string(PoolOverflowPolicy policy);
+
+// Фіксований набір сутностей, створених наперед у EntityManager. acquire/release лише перекладають
+// вказівники між списками з зарезервованою місткістю, тож у сталому бою пул не виділяє пам'яті
+class EntityPool {
+public:
+  using Builder = std::function<void(Entity*)>;
+  using ReleaseCallback = std::function<void(Entity*)>;
+
+private:
+  std::vector<Entity*> free_;
+  // Активні в порядку видачі: найстаріший — перший
+  std::vector<Entity*> active_;
+  size_t capacity_ = 0;
+  PoolOverflowPolicy policy_;
+  ReleaseCallback on_release_;
+  size_t overflow_count_ = 0;
+
+public:
+  explicit EntityPool(PoolOverflowPolicy policy = PoolOverflowPolicy::DROP_NEW);
+
+  // Створює capacity сутностей; build додає їм компоненти. Повторний виклик забуває попередні слоти
+  void init(EntityManager &manager, size_t capacity, const Builder &build);
+  // Викликається для кожної звільненої сутності, зокрема витісненої політикою
+  void set_release_callback(ReleaseCallback callback) { on_release_ = std::move(callback); }
+
+  // Вільний слот або витіснений за політикою; nullptr — пул повний і політика DROP_NEW.
+  // reference — опорна точка для RECYCLE_FARTHEST
+  Entity* acquire(Vector2 reference = {0.f, 0.f});
+  void release(Entity *entity);
+  void release_all();
+  // Звільняє всі активні, для яких predicate(entity) == true; порядок решти зберігається
+  template<typename Predicate>
+  size_t release_if(Predicate predicate);
+
+  // Забуває всі слоти без колбеків — коли сутності знищує сам EntityManager
+  void clear();
+
+  void set_policy(PoolOverflowPolicy policy) { policy_ = policy; }
+  PoolOverflowPolicy get_policy() const { return policy_; }
+
+  const std::vector<Entity*>& get_active() const { return active_; }
+  size_t get_active_count() const { return active_.size(); }
+  size_t get_capacity() const { return capacity_; }
+  bool is_full() const { return free_.empty(); }
+  // Скільки разів запит прийшов у повний пул
+  size_t get_overflow_count() const { return overflow_count_; }
+
+private:
+  Entity* select_victim(Vector2 reference) const;
+};
+
+template<typename Predicate>
+size_t EntityPool::release_if(Predicate predicate) {
+  size_t kept = 0;
+  for (Entity *entity : active_) {
+    if (predicate(entity)) {
+      free_.push_back(entity);
+      if (on_release_) {
+        on_release_(entity);
+      }
+    } else {
+      active_[kept++] = entity;
+    }
+  }
+
+  const size_t released = active_.size() - kept;
+  active_.resize(kept);
+  return released;
+}
@@ -0,0 +1,22 @@
+#include "InputSnapshot.h"
+
+#include "raylib.h"
+#include "systems/render/RenderBackend.h"
+
+InputSnapshot InputSnapshot::capture() {
+  InputSnapshot snapshot;
+  const RenderBackend &backend = RenderBackend::get();
+  snapshot.delta_time = backend.get_frame_time();
+  snapshot.fps = backend.get_fps();
+
+  // Коди клавіш raylib починаються з KEY_SPACE (32) і закінчуються KEY_KB_MENU (348)
+  for (int key = 32; key < KEY_COUNT; ++key) {
+    if (IsKeyDown(key)) {
+      snapshot.down.set(key);
+    }
+    if (IsKeyPressed(key)) {
+      snapshot.pressed.set(key);
+    }
+  }
+  return snapshot;
+}
@@ -0,0 +1,18 @@
+#pragma once
+#include <bitset>
+
+// Стан клавіатури й таймінгу кадру, знятий на головному потоці.
+// Симуляція читає лише його — raylib-функції вводу не потокобезпечні
+struct InputSnapshot {
+  static constexpr int KEY_COUNT = 512;
+
+  float delta_time = 0.f;
+  int fps = 0;
+  std::bitset<KEY_COUNT> down;
+  std::bitset<KEY_COUNT> pressed;
+
+  static InputSnapshot capture();
+
+  bool is_key_down(const int key) const { return key >= 0 && key < KEY_COUNT && down[key]; }
+  bool is_key_pressed(const int key) const { return key >= 0 && key < KEY_COUNT && pressed[key]; }
+};
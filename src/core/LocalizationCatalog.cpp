@@ -0,0 +1,89 @@
+#include "LocalizationCatalog.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "utils.h"
+
+using namespace LocalizationFormat;
+
+bool LocalizationCatalog::open(const std::string &path) {
+  close();
+
+  if (!file_.open(path)) {
+    TRACELOG(LOG_WARNING, "Localization catalog '%s' can't be mapped", path.c_str());
+    return false;
+  }
+
+  if (!validate()) {
+    TRACELOG(LOG_WARNING, "Localization catalog '%s' is corrupted or has wrong version", path.c_str());
+    file_.close();
+    return false;
+  }
+
+  CatalogHeader header;
+  std::memcpy(&header, file_.data(), sizeof(header));
+  entry_count_ = header.entry_count;
+  blob_size_ = header.blob_size;
+  entries_ = reinterpret_cast<const CatalogEntry*>(file_.data() + sizeof(CatalogHeader));
+  blob_ = file_.data() + sizeof(CatalogHeader) + entry_count_ * sizeof(CatalogEntry);
+
+  TRACELOG(LOG_INFO, "Localization catalog '%s' mapped: %u strings", path.c_str(), entry_count_);
+  return true;
+}
+
+void LocalizationCatalog::close() {
+  file_.close();
+  entries_ = nullptr;
+  blob_ = nullptr;
+  entry_count_ = 0;
+  blob_size_ = 0;
+}
+
+std::string_view LocalizationCatalog::get_blob() const {
+  return blob_ ? std::string_view(blob_, blob_size_) : std::string_view{};
+}
+
+const char* LocalizationCatalog::find(const std::uint32_t key_hash) const {
+  const CatalogEntry* end = entries_ + entry_count_;
+  const CatalogEntry* it = std::lower_bound(entries_, end, key_hash,
+                                            [](const CatalogEntry &entry, const std::uint32_t hash) {
+                                              return entry.key_hash < hash;
+                                            });
+  if (it == end || it->key_hash != key_hash) {
+    return nullptr;
+  }
+  return blob_ + it->offset;
+}
+
+bool LocalizationCatalog::validate() const {
+  const size_t size = file_.size();
+  if (size < sizeof(CatalogHeader)) {
+    return false;
+  }
+
+  CatalogHeader header;
+  std::memcpy(&header, file_.data(), sizeof(header));
+  if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION) {
+    return false;
+  }
+
+  const size_t table_size = static_cast<size_t>(header.entry_count) * sizeof(CatalogEntry);
+  if (size != sizeof(CatalogHeader) + table_size + header.blob_size) {
+    return false;
+  }
+
+  // Один прохід по таблиці: порядок для бінарного пошуку і термінатор кожного рядка в межах blob
+  const auto* entries = reinterpret_cast<const CatalogEntry*>(file_.data() + sizeof(CatalogHeader));
+  const char* blob = file_.data() + sizeof(CatalogHeader) + table_size;
+  for (std::uint32_t i = 0; i < header.entry_count; ++i) {
+    const CatalogEntry &entry = entries[i];
+    if (i > 0 && entries[i - 1].key_hash >= entry.key_hash) {
+      return false;
+    }
+    if (static_cast<size_t>(entry.offset) + entry.length >= header.blob_size || blob[entry.offset + entry.length] != '\0') {
+      return false;
+    }
+  }
+  return true;
+}
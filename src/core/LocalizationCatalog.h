@@ -0,0 +1,73 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "MappedFile.h"
+
+// Скомпільований каталог перекладів (.bloc), який збирає tools/LocalizationCompiler з assets/lang/*.lang.
+// Розкладка (little-endian, без вирівнювання між секціями — усе кратне 4 байтам):
+//   CatalogHeader
+//   CatalogEntry[entry_count]   — відсортовані за key_hash
+//   char blob[blob_size]        — рядки з нульовим термінатором
+// Файл відображається в пам'ять як є: рядки віддаються прямо з blob, без розбору і копіювання
+namespace LocalizationFormat {
+
+constexpr char MAGIC[4] = {'B', 'L', 'O', 'C'};
+constexpr std::uint32_t VERSION = 1;
+
+struct CatalogHeader {
+  char magic[4];
+  std::uint32_t version;
+  std::uint32_t entry_count;
+  std::uint32_t blob_size;
+};
+
+struct CatalogEntry {
+  std::uint32_t key_hash;
+  std::uint32_t offset;
+  std::uint32_t length;
+};
+
+static_assert(sizeof(CatalogHeader) == 16);
+static_assert(sizeof(CatalogEntry) == 12);
+
+// FNV-1a: ключі хешуються під час компіляції, тож у грі рядкових порівнянь немає
+constexpr std::uint32_t hash_key(const std::string_view key) {
+  std::uint32_t hash = 2166136261u;
+  for (const char c : key) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+} // namespace LocalizationFormat
+
+class LocalizationCatalog {
+private:
+  MappedFile file_;
+  const LocalizationFormat::CatalogEntry* entries_ = nullptr;
+  const char* blob_ = nullptr;
+  std::uint32_t entry_count_ = 0;
+  std::uint32_t blob_size_ = 0;
+
+public:
+  // Відображає файл і перевіряє заголовок та межі записів; при помилці каталог лишається порожнім
+  bool open(const std::string &path);
+  void close();
+
+  // Бінарний пошук за хешем ключа; nullptr, якщо ключа немає
+  [[nodiscard]] const char* find(std::uint32_t key_hash) const;
+  [[nodiscard]] const char* find(const std::string_view key) const { return find(LocalizationFormat::hash_key(key)); }
+
+  // Усі рядки підряд, розділені нулями — для обходу без таблиці (напр. збору символів для шрифту)
+  [[nodiscard]] std::string_view get_blob() const;
+
+  [[nodiscard]] bool is_loaded() const { return entries_ != nullptr; }
+  [[nodiscard]] size_t get_entry_count() const { return entry_count_; }
+
+private:
+  bool validate() const;
+};
@@ -0,0 +1,31 @@
+#pragma once
+#include <cstddef>
+#include <string>
+
+// Файл, відображений у пам'ять лише для читання. Сторінки підтягує ОС при першому доступі,
+// тож відкриття нічого не читає і не копіює
+class MappedFile {
+private:
+  const char* data_ = nullptr;
+  size_t size_ = 0;
+#ifdef _WIN32
+  void* file_handle_ = nullptr;
+  void* mapping_handle_ = nullptr;
+#endif
+
+public:
+  MappedFile() = default;
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile(MappedFile &&other) noexcept;
+  MappedFile& operator=(MappedFile &&other) noexcept;
+
+  bool open(const std::string &path);
+  void close();
+
+  [[nodiscard]] bool is_open() const { return data_ != nullptr; }
+  [[nodiscard]] const char* data() const { return data_; }
+  [[nodiscard]] size_t size() const { return size_; }
+};
@@ -0,0 +1,39 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Стабільне LSD radix-сортування 64-бітних ключів разом із прив'язаними значеннями.
+// Проходи, де всі ключі мають однаковий байт, пропускаються.
+template<typename Value>
+void radix_sort(std::vector<std::uint64_t> &keys, std::vector<Value> &values,
+                std::vector<std::uint64_t> &scratch_keys, std::vector<Value> &scratch_values) {
+  const size_t count = keys.size();
+  scratch_keys.resize(count);
+  scratch_values.resize(count);
+
+  for (unsigned int shift = 0; shift < 64; shift += 8) {
+    std::array<size_t, 257> offsets{};
+    for (const std::uint64_t key : keys) {
+      ++offsets[((key >> shift) & 0xFF) + 1];
+    }
+
+    if (count == 0 || offsets[((keys[0] >> shift) & 0xFF) + 1] == count) {
+      continue;
+    }
+
+    for (size_t bucket = 0; bucket < 256; ++bucket) {
+      offsets[bucket + 1] += offsets[bucket];
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+      const size_t destination = offsets[(keys[i] >> shift) & 0xFF]++;
+      scratch_keys[destination] = keys[i];
+      scratch_values[destination] = values[i];
+    }
+
+    keys.swap(scratch_keys);
+    values.swap(scratch_values);
+  }
+}
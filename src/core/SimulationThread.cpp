@@ -0,0 +1,58 @@
+#include "SimulationThread.h"
+
+SimulationThread::SimulationThread(Step step)
+  : step_(std::move(step))
+  , thread_(&SimulationThread::run, this) {
+}
+
+SimulationThread::~SimulationThread() {
+  stop();
+}
+
+void SimulationThread::start(const InputSnapshot &input) {
+  {
+    std::lock_guard lock(mutex_);
+    input_ = input;
+    has_work_ = true;
+  }
+  condition_.notify_all();
+}
+
+void SimulationThread::wait() {
+  std::unique_lock lock(mutex_);
+  condition_.wait(lock, [this] { return !has_work_; });
+}
+
+void SimulationThread::stop() {
+  {
+    std::unique_lock lock(mutex_);
+    condition_.wait(lock, [this] { return !has_work_; });
+    if (stopping_) {
+      return;
+    }
+    stopping_ = true;
+  }
+  condition_.notify_all();
+  thread_.join();
+}
+
+void SimulationThread::run() {
+  while (true) {
+    {
+      std::unique_lock lock(mutex_);
+      condition_.wait(lock, [this] { return stopping_ || has_work_; });
+      if (stopping_) {
+        return;
+      }
+    }
+
+    // input_ не змінюється, поки has_work_ == true, тож читаємо без блокування
+    step_(input_);
+
+    {
+      std::lock_guard lock(mutex_);
+      has_work_ = false;
+    }
+    condition_.notify_all();
+  }
+}
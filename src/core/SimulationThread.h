@@ -0,0 +1,39 @@
+#pragma once
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "InputSnapshot.h"
+
+// Окремий потік симуляції, що працює кадр у кадр з головним (рендер-) потоком.
+// start() запускає крок N+1, поки головний потік малює кадр N; wait() — точка синхронізації
+class SimulationThread {
+public:
+  using Step = std::function<void(const InputSnapshot&)>;
+
+private:
+  Step step_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  InputSnapshot input_;
+  bool has_work_ = false;
+  bool stopping_ = false;
+  // Останнім: потік стартує в конструкторі, коли решта полів уже готова
+  std::thread thread_;
+
+public:
+  explicit SimulationThread(Step step);
+  ~SimulationThread();
+
+  SimulationThread(const SimulationThread&) = delete;
+  SimulationThread& operator=(const SimulationThread&) = delete;
+
+  void start(const InputSnapshot &input);
+  // Блокує, доки поточний крок не завершиться; без запущеного кроку повертається одразу
+  void wait();
+  void stop();
+
+private:
+  void run();
+};
@@ -0,0 +1,36 @@
+#include "SpatialGrid.h"
+
+#include <algorithm>
+#include <ranges>
+
+void SpatialGrid::insert(const std::uint32_t item, const CellKey cell) {
+  cells_[cell].push_back(item);
+}
+
+void SpatialGrid::remove(const std::uint32_t item, const CellKey cell) {
+  const auto it = cells_.find(cell);
+  if (it == cells_.end()) {
+    return;
+  }
+
+  auto &items = it->second;
+  if (const auto found = std::ranges::find(items, item); found != items.end()) {
+    *found = items.back();
+    items.pop_back();
+  }
+  // Порожні клітинки лишаються в мапі, щоб не перевиділяти пам'ять при поверненні
+}
+
+void SpatialGrid::move(const std::uint32_t item, const CellKey from, const CellKey to) {
+  if (from == to) {
+    return;
+  }
+  remove(item, from);
+  insert(item, to);
+}
+
+void SpatialGrid::clear() {
+  for (auto &items : cells_ | std::views::values) {
+    items.clear();
+  }
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "raylib.h"
+
+// Розріджена рівномірна сітка точкових елементів; елемент живе в одній клітинці
+class SpatialGrid {
+public:
+  using CellKey = std::uint64_t;
+
+private:
+  float cell_size_;
+  std::unordered_map<CellKey, std::vector<std::uint32_t>> cells_;
+
+public:
+  explicit SpatialGrid(float cell_size) : cell_size_(cell_size) {}
+
+  float get_cell_size() const { return cell_size_; }
+
+  int to_cell(const float coordinate) const { return static_cast<int>(std::floor(coordinate / cell_size_)); }
+
+  static CellKey make_key(const int x, const int y) {
+    return (static_cast<CellKey>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+  }
+
+  CellKey cell_of(const Vector2 position) const { return make_key(to_cell(position.x), to_cell(position.y)); }
+
+  void insert(std::uint32_t item, CellKey cell);
+  void remove(std::uint32_t item, CellKey cell);
+  void move(std::uint32_t item, CellKey from, CellKey to);
+  void clear();
+
+  // Викликає visit для кожного елемента з клітинок, що перетинають area
+  template<typename Visitor>
+  void query(const Rectangle &area, Visitor &&visit) const {
+    const int x0 = to_cell(area.x);
+    const int y0 = to_cell(area.y);
+    const int x1 = to_cell(area.x + area.width);
+    const int y1 = to_cell(area.y + area.height);
+
+    for (int y = y0; y <= y1; ++y) {
+      for (int x = x0; x <= x1; ++x) {
+        if (const auto it = cells_.find(make_key(x, y)); it != cells_.end()) {
+          for (const std::uint32_t item : it->second) {
+            visit(item);
+          }
+        }
+      }
+    }
+  }
+};
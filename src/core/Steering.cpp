@@ -0,0 +1,165 @@
+#include "Steering.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if !defined(BULBYK_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define BULBYK_STEERING_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace Steering {
+
+namespace {
+
+// Спільна формула обох шляхів: v = d * (speed / |d|), нуль у межах stop_radius.
+// На нульовій відстані speed / 0 дає inf, але умова distance > stop_radius тоді хибна
+inline void steer_one(const ChaseBatch &batch, const size_t i, const Vector2 target, const float stop_radius) {
+  const float dx = (batch.target_x ? batch.target_x[i] : target.x) - batch.position_x[i];
+  const float dy = (batch.target_y ? batch.target_y[i] : target.y) - batch.position_y[i];
+  const float distance = std::sqrt(dx * dx + dy * dy);
+  if (distance > stop_radius) {
+    const float scale = batch.speed[i] / distance;
+    batch.velocity_x[i] = dx * scale;
+    batch.velocity_y[i] = dy * scale;
+  } else {
+    batch.velocity_x[i] = 0.f;
+    batch.velocity_y[i] = 0.f;
+  }
+}
+
+// Те саме плюс зсув: крок обрізається до відстані, що лишилась до stop_radius, тож великий dt
+// (напр. рідкісний крок далекого агента) не перестрибує зупинку і не тремтить довкола цілі
+inline void chase_one(const ChaseBatch &batch, const size_t i, const Vector2 target, const float stop_radius,
+                      const float delta_time) {
+  const float dx = (batch.target_x ? batch.target_x[i] : target.x) - batch.position_x[i];
+  const float dy = (batch.target_y ? batch.target_y[i] : target.y) - batch.position_y[i];
+  const float distance = std::sqrt(dx * dx + dy * dy);
+  if (distance > stop_radius) {
+    const float scale = batch.speed[i] / distance;
+    const float step_time = batch.delta_time ? batch.delta_time[i] : delta_time;
+    const float travel = std::min(batch.speed[i] * step_time, distance - stop_radius) / distance;
+    batch.velocity_x[i] = dx * scale;
+    batch.velocity_y[i] = dy * scale;
+    batch.position_x[i] += dx * travel;
+    batch.position_y[i] += dy * travel;
+  } else {
+    batch.velocity_x[i] = 0.f;
+    batch.velocity_y[i] = 0.f;
+  }
+}
+
+#ifdef BULBYK_STEERING_SSE2
+
+// Чотири агенти з i: швидкості у vx/vy, маска відкидає тих, хто вже в stop_radius
+inline void steer_four(const ChaseBatch &batch, const size_t i, const __m128 target_x, const __m128 target_y,
+                       const __m128 stop_radius, __m128 &vx, __m128 &vy) {
+  const __m128 goal_x = batch.target_x ? _mm_loadu_ps(batch.target_x + i) : target_x;
+  const __m128 goal_y = batch.target_y ? _mm_loadu_ps(batch.target_y + i) : target_y;
+  const __m128 dx = _mm_sub_ps(goal_x, _mm_loadu_ps(batch.position_x + i));
+  const __m128 dy = _mm_sub_ps(goal_y, _mm_loadu_ps(batch.position_y + i));
+  const __m128 distance = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+  const __m128 moving = _mm_cmpgt_ps(distance, stop_radius);
+  const __m128 scale = _mm_div_ps(_mm_loadu_ps(batch.speed + i), distance);
+
+  // and з маскою обнуляє і зупинених, і NaN від 0 * inf
+  vx = _mm_and_ps(moving, _mm_mul_ps(dx, scale));
+  vy = _mm_and_ps(moving, _mm_mul_ps(dy, scale));
+}
+
+// Як chase_one для чотирьох агентів: швидкості у vx/vy, обрізаний зсув — у step_x/step_y
+inline void chase_four(const ChaseBatch &batch, const size_t i, const __m128 target_x, const __m128 target_y,
+                       const __m128 stop_radius, const __m128 delta_time, __m128 &vx, __m128 &vy,
+                       __m128 &step_x, __m128 &step_y) {
+  const __m128 goal_x = batch.target_x ? _mm_loadu_ps(batch.target_x + i) : target_x;
+  const __m128 goal_y = batch.target_y ? _mm_loadu_ps(batch.target_y + i) : target_y;
+  const __m128 dx = _mm_sub_ps(goal_x, _mm_loadu_ps(batch.position_x + i));
+  const __m128 dy = _mm_sub_ps(goal_y, _mm_loadu_ps(batch.position_y + i));
+  const __m128 distance = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+  const __m128 moving = _mm_cmpgt_ps(distance, stop_radius);
+  const __m128 speed = _mm_loadu_ps(batch.speed + i);
+  const __m128 scale = _mm_div_ps(speed, distance);
+  const __m128 step_time = batch.delta_time ? _mm_loadu_ps(batch.delta_time + i) : delta_time;
+  // _mm_min_ps(x, y) = x < y ? x : y, тож операнди переставлені відносно std::min(a, b) = b < a ? b : a
+  const __m128 travel = _mm_div_ps(
+    _mm_min_ps(_mm_sub_ps(distance, stop_radius), _mm_mul_ps(speed, step_time)), distance);
+
+  vx = _mm_and_ps(moving, _mm_mul_ps(dx, scale));
+  vy = _mm_and_ps(moving, _mm_mul_ps(dy, scale));
+  step_x = _mm_and_ps(moving, _mm_mul_ps(dx, travel));
+  step_y = _mm_and_ps(moving, _mm_mul_ps(dy, travel));
+}
+
+#endif
+
+} // namespace
+
+void steer_scalar(const ChaseBatch &batch, const Vector2 target, const float stop_radius, const size_t begin) {
+  for (size_t i = begin; i < batch.count; ++i) {
+    steer_one(batch, i, target, stop_radius);
+  }
+}
+
+void chase_scalar(const ChaseBatch &batch, const Vector2 target, const float stop_radius, const float delta_time,
+                  const size_t begin) {
+  for (size_t i = begin; i < batch.count; ++i) {
+    chase_one(batch, i, target, stop_radius, delta_time);
+  }
+}
+
+#ifdef BULBYK_STEERING_SSE2
+
+void steer(const ChaseBatch &batch, const Vector2 target, const float stop_radius) {
+  const __m128 target_x = _mm_set1_ps(target.x);
+  const __m128 target_y = _mm_set1_ps(target.y);
+  const __m128 radius = _mm_set1_ps(stop_radius);
+
+  size_t i = 0;
+  for (; i + 4 <= batch.count; i += 4) {
+    __m128 vx, vy;
+    steer_four(batch, i, target_x, target_y, radius, vx, vy);
+    _mm_storeu_ps(batch.velocity_x + i, vx);
+    _mm_storeu_ps(batch.velocity_y + i, vy);
+  }
+  steer_scalar(batch, target, stop_radius, i);
+}
+
+void chase(const ChaseBatch &batch, const Vector2 target, const float stop_radius, const float delta_time) {
+  const __m128 target_x = _mm_set1_ps(target.x);
+  const __m128 target_y = _mm_set1_ps(target.y);
+  const __m128 radius = _mm_set1_ps(stop_radius);
+  const __m128 dt = _mm_set1_ps(delta_time);
+
+  size_t i = 0;
+  for (; i + 4 <= batch.count; i += 4) {
+    __m128 vx, vy, step_x, step_y;
+    chase_four(batch, i, target_x, target_y, radius, dt, vx, vy, step_x, step_y);
+    _mm_storeu_ps(batch.velocity_x + i, vx);
+    _mm_storeu_ps(batch.velocity_y + i, vy);
+    _mm_storeu_ps(batch.position_x + i, _mm_add_ps(_mm_loadu_ps(batch.position_x + i), step_x));
+    _mm_storeu_ps(batch.position_y + i, _mm_add_ps(_mm_loadu_ps(batch.position_y + i), step_y));
+  }
+  chase_scalar(batch, target, stop_radius, delta_time, i);
+}
+
+bool is_simd_enabled() {
+  return true;
+}
+
+#else
+
+void steer(const ChaseBatch &batch, const Vector2 target, const float stop_radius) {
+  steer_scalar(batch, target, stop_radius);
+}
+
+void chase(const ChaseBatch &batch, const Vector2 target, const float stop_radius, const float delta_time) {
+  chase_scalar(batch, target, stop_radius, delta_time);
+}
+
+bool is_simd_enabled() {
+  return false;
+}
+
+#endif
+
+} // namespace Steering
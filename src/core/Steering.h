@@ -0,0 +1,39 @@
+#pragma once
+#include <cstddef>
+
+#include "raylib.h"
+
+// Пакетне переслідування: для кожного агента напрям на спільну або власну ціль, швидкість speed[i]
+// і зупинка в межах stop_radius. Основний шлях — SSE2 по чотири агенти, хвіст і платформи
+// без SSE2 (або збірка з BULBYK_NO_SIMD) йдуть скалярним циклом з тією ж формулою.
+// Масиви — звичайні SoA-стовпці без вимог до вирівнювання
+namespace Steering {
+
+struct ChaseBatch {
+  float *position_x;
+  float *position_y;
+  float *velocity_x;
+  float *velocity_y;
+  const float *speed;
+  size_t count;
+  // Власна точка кожного агента (напр. з поля напрямків); без них усі йдуть на спільну ціль
+  const float *target_x = nullptr;
+  const float *target_y = nullptr;
+  // Власний крок часу кожного агента (напр. проріджені рівні деталізації); без нього — спільний delta_time
+  const float *delta_time = nullptr;
+};
+
+// Лише нові швидкості — для поведінки, що ще змінює їх перед інтегруванням
+void steer(const ChaseBatch &batch, Vector2 target, float stop_radius);
+// Швидкості й позиції за один прохід; зсув не перетинає stop_radius навіть за великого delta_time.
+// delta_time ігнорується, якщо в пачці є власний крок часу агентів
+void chase(const ChaseBatch &batch, Vector2 target, float stop_radius, float delta_time);
+
+// Скалярні версії — еталон для перевірки і запасний шлях
+void steer_scalar(const ChaseBatch &batch, Vector2 target, float stop_radius, size_t begin = 0);
+void chase_scalar(const ChaseBatch &batch, Vector2 target, float stop_radius, float delta_time, size_t begin = 0);
+
+// true, якщо збірка використовує SIMD-шлях
+bool is_simd_enabled();
+
+} // namespace Steering
@@ -0,0 +1,44 @@
+#include "TextureRegistry.h"
+
+#include <limits>
+
+#include "raylib.h"
+#include "utils.h"
+
+// Ініціалізація статичних членів
+std::unordered_map<std::string, TextureHandle> TextureRegistry::handles_;
+std::deque<std::string> TextureRegistry::names_{"<placeholder>"};
+std::mutex TextureRegistry::mutex_;
+
+TextureHandle TextureRegistry::intern(const std::string &name) {
+  std::lock_guard lock(mutex_);
+  if (const auto it = handles_.find(name); it != handles_.end()) {
+    return it->second;
+  }
+
+  if (names_.size() > std::numeric_limits<TextureHandle>::max()) {
+    TRACELOG(LOG_ERROR, "TextureRegistry is full, %s uses placeholder", name.c_str());
+    return PLACEHOLDER;
+  }
+
+  const auto handle = static_cast<TextureHandle>(names_.size());
+  names_.push_back(name);
+  handles_.emplace(name, handle);
+  return handle;
+}
+
+TextureHandle TextureRegistry::find(const std::string &name) {
+  std::lock_guard lock(mutex_);
+  const auto it = handles_.find(name);
+  return it != handles_.end() ? it->second : PLACEHOLDER;
+}
+
+const std::string& TextureRegistry::get_name(const TextureHandle handle) {
+  std::lock_guard lock(mutex_);
+  return handle < names_.size() ? names_[handle] : names_[PLACEHOLDER];
+}
+
+size_t TextureRegistry::get_count() {
+  std::lock_guard lock(mutex_);
+  return names_.size();
+}
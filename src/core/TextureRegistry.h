@@ -0,0 +1,30 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+using TextureHandle = std::uint16_t;
+
+// Інтернує імена текстур у малі цілі хендли; рядок хешується лише один раз при створенні спрайта.
+// Спрайти створює потік симуляції, а завантажувачі — головний, тож усі методи під спільним м'ютексом.
+// names_ — deque: посилання з get_name лишаються чинними, коли інший потік додає нове ім'я
+class TextureRegistry {
+public:
+  // Хендл 0 ніколи не видається імені — це спільна текстура-заглушка
+  static constexpr TextureHandle PLACEHOLDER = 0;
+
+private:
+  static std::unordered_map<std::string, TextureHandle> handles_;
+  static std::deque<std::string> names_;
+  static std::mutex mutex_;
+
+public:
+  // Повертає наявний хендл або реєструє новий; текстуру можна завантажити пізніше
+  static TextureHandle intern(const std::string &name);
+  static TextureHandle find(const std::string &name);
+  static const std::string& get_name(TextureHandle handle);
+  static size_t get_count();
+};
@@ -0,0 +1,52 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+size_t ThreadPool::get_default_thread_count() {
+  // Один потік лишаємо головному циклу гри
+  const unsigned int hardware = std::thread::hardware_concurrency();
+  return std::max(1u, hardware > 1 ? hardware - 1 : 1u);
+}
+
+ThreadPool::ThreadPool(const size_t thread_count) {
+  workers_.reserve(thread_count);
+  for (size_t i = 0; i < thread_count; ++i) {
+    workers_.emplace_back(&ThreadPool::worker_loop, this);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  shutdown();
+}
+
+void ThreadPool::shutdown() {
+  {
+    std::lock_guard lock(mutex_);
+    if (stopping_) {
+      return;
+    }
+    stopping_ = true;
+  }
+  condition_.notify_all();
+
+  for (std::thread &worker : workers_) {
+    worker.join();
+  }
+  workers_.clear();
+}
+
+void ThreadPool::worker_loop() {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock lock(mutex_);
+      condition_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+      if (tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop();
+    }
+    task();
+  }
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Фіксований набір робочих потоків зі спільною чергою задач
+class ThreadPool {
+private:
+  std::vector<std::thread> workers_;
+  std::queue<std::function<void()>> tasks_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  bool stopping_ = false;
+
+public:
+  static size_t get_default_thread_count();
+
+  explicit ThreadPool(size_t thread_count = get_default_thread_count());
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  template<typename Task>
+  auto submit(Task &&task) -> std::future<std::invoke_result_t<Task>> {
+    using Result = std::invoke_result_t<Task>;
+    auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<Task>(task));
+    std::future<Result> result = packaged->get_future();
+    {
+      std::lock_guard lock(mutex_);
+      tasks_.emplace([packaged] { (*packaged)(); });
+    }
+    condition_.notify_one();
+    return result;
+  }
+
+  // Дочікується вже поставлених задач і зупиняє потоки; повторний виклик нічого не робить
+  void shutdown();
+
+  size_t get_thread_count() const { return workers_.size(); }
+
+private:
+  void worker_loop();
+};
@@ -1,10 +1,12 @@
 #include <iostream>
 
 #include "Game.h"
+#include "systems/render/RenderBackend.h"
 
 
-int main() {
+int main(int argc, char **argv) {
     try {
+        RenderBackend::init_from_args(argc, argv);
 
         std::cout << "🌾 Запуск БУЛЬБИК: ДО КОРЕНЯ ЗЛА" << std::endl;
 
@@ -0,0 +1,103 @@
+#include "AssetLoader.h"
+
+#include <ranges>
+
+#include "RenderSystem.h"
+#include "utils.h"
+
+AssetLoader::AssetLoader(const size_t thread_count) : pool_(thread_count) {
+}
+
+AssetLoader::~AssetLoader() {
+  // Ще не почате декодування пропускаємо, вже декодоване — звільняємо
+  cancelled_ = true;
+  pool_.shutdown();
+
+  for (const DecodedImage &decoded : completed_) {
+    if (decoded.image.data != nullptr) {
+      UnloadImage(decoded.image);
+    }
+  }
+  for (auto &promise : pending_ | std::views::values) {
+    promise.set_value(false);
+  }
+}
+
+TextureRequest AssetLoader::load_texture_async(const std::string &name, const std::string &path) {
+  const TextureHandle handle = TextureRegistry::intern(name);
+
+  std::promise<bool> promise;
+  std::shared_future<bool> ready = promise.get_future().share();
+  {
+    std::lock_guard lock(mutex_);
+    if (const auto it = requests_.find(handle); it != requests_.end()) {
+      return {handle, it->second};
+    }
+    pending_.emplace(handle, std::move(promise));
+    requests_.emplace(handle, ready);
+  }
+  ++requested_;
+
+  pool_.submit([this, handle, path] {
+    if (cancelled_) {
+      return;
+    }
+
+    const Image image = LoadImage(path.c_str());
+    if (image.data == nullptr) {
+      TRACELOG(LOG_ERROR, "Failed to load texture %s", path.c_str());
+    }
+
+    std::lock_guard lock(mutex_);
+    completed_.push_back({handle, image});
+    ++decoded_;
+  });
+
+  return {handle, ready};
+}
+
+size_t AssetLoader::pump(RenderSystem &render_system, const size_t max_uploads) {
+  size_t uploads = 0;
+
+  while (uploads < max_uploads) {
+    DecodedImage decoded;
+    std::promise<bool> promise;
+    {
+      std::lock_guard lock(mutex_);
+      if (completed_.empty()) {
+        break;
+      }
+      decoded = completed_.front();
+      completed_.pop_front();
+
+      const auto it = pending_.find(decoded.handle);
+      promise = std::move(it->second);
+      pending_.erase(it);
+    }
+
+    // Невдалі зображення GPU не торкаються, тож ліміт кадру не витрачають
+    if (decoded.image.data == nullptr) {
+      ++failed_;
+      promise.set_value(false);
+      continue;
+    }
+
+    if (!render_system.add_image(decoded.handle, decoded.image)) {
+      // Текстуру вже завантажили синхронно — наша копія зайва
+      UnloadImage(decoded.image);
+    }
+    ++uploaded_;
+    ++uploads;
+    promise.set_value(true);
+  }
+
+  return uploads;
+}
+
+LoadProgress AssetLoader::get_progress() const {
+  return {requested_, decoded_, uploaded_, failed_};
+}
+
+bool AssetLoader::is_idle() const {
+  return uploaded_ + failed_ == requested_;
+}
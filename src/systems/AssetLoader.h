@@ -0,0 +1,73 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "raylib.h"
+#include "../core/TextureRegistry.h"
+#include "../core/ThreadPool.h"
+
+class RenderSystem;
+
+// Хендл відомий одразу; ready стає true після завантаження на GPU, false — якщо файл не прочитався
+struct TextureRequest {
+  TextureHandle handle = TextureRegistry::PLACEHOLDER;
+  std::shared_future<bool> ready;
+};
+
+struct LoadProgress {
+  size_t requested = 0;
+  size_t decoded = 0;
+  size_t uploaded = 0;
+  size_t failed = 0;
+
+  float get_fraction() const {
+    return requested == 0 ? 1.f : static_cast<float>(uploaded + failed) / static_cast<float>(requested);
+  }
+};
+
+// Читання й декодування файлів — на робочих потоках, завантаження на GPU — у pump() на головному
+class AssetLoader {
+public:
+  static constexpr size_t DEFAULT_UPLOADS_PER_FRAME = 4;
+
+private:
+  struct DecodedImage {
+    TextureHandle handle;
+    Image image;
+  };
+
+  std::mutex mutex_;
+  std::deque<DecodedImage> completed_;
+  std::unordered_map<TextureHandle, std::promise<bool>> pending_;
+  std::unordered_map<TextureHandle, std::shared_future<bool>> requests_;
+
+  std::atomic<size_t> requested_ = 0;
+  std::atomic<size_t> decoded_ = 0;
+  std::atomic<size_t> uploaded_ = 0;
+  std::atomic<size_t> failed_ = 0;
+  std::atomic<bool> cancelled_ = false;
+
+  // Оголошений останнім: потоки мають зупинитися раніше, ніж зникне черга
+  ThreadPool pool_;
+
+public:
+  explicit AssetLoader(size_t thread_count = ThreadPool::get_default_thread_count());
+  ~AssetLoader();
+
+  AssetLoader(const AssetLoader&) = delete;
+  AssetLoader& operator=(const AssetLoader&) = delete;
+
+  // Повторний запит того ж імені повертає вже наявний future
+  TextureRequest load_texture_async(const std::string &name, const std::string &path);
+
+  // Викликається щокадру з потоку рендера; вантажить на GPU не більше max_uploads текстур
+  size_t pump(RenderSystem &render_system, size_t max_uploads = DEFAULT_UPLOADS_PER_FRAME);
+
+  LoadProgress get_progress() const;
+  bool is_idle() const;
+};
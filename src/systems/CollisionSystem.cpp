@@ -4,6 +4,7 @@
 
 #include "CollisionSystem.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include "utils.h"
@@ -32,143 +33,177 @@ void CollisionSystem::unregister_entity(const Entity *entity) {
   }
 }
 
+void CollisionSystem::reserve(const size_t capacity) {
+  entities_.reserve(capacity);
+  proxies_.reserve(capacity);
+  proxy_data_.reserve(capacity);
+}
+
+CollisionSystem::CollisionSystem()
+  : broadphase_(Broadphase::create(BroadphaseType::ALL_PAIRS, grid_cell_size_)) {
+}
+
 void CollisionSystem::update() {
-  for (size_t i = 0; i < entities_.size(); ++i) {
-    for (size_t j = i + 1; j < entities_.size(); ++j) {
-      Entity *entity_a = entities_[i];
-      Entity *entity_b = entities_[j];
-
-      CollisionInfo info;
-      if (check_collision(entity_a, entity_b, &info)) {
-        resolve_collision(info);
-        for (const auto &callback: collision_callbacks_) {
-          callback(info);
-        }
+  build_proxies();
+
+  if (auto_tune_ && tuner_.should_sample()) {
+    apply_broadphase_choice(BroadphaseTuner::choose(proxies_));
+  }
+
+  broadphase_->find_pairs(proxies_, pairs_);
+  sort_pairs_by_shape();
+
+  // Кожен кернел проходить однорідну пачку пар одного типу
+  size_t hits = 0;
+  for (size_t bucket = 0; bucket < Narrowphase::PAIR_COUNT; ++bucket) {
+    const Narrowphase::Test test = Narrowphase::DISPATCH_TABLE[bucket];
+    for (size_t k = shape_pair_offsets_[bucket]; k < shape_pair_offsets_[bucket + 1]; ++k) {
+      const auto [a, b] = shape_pairs_[k];
+      if (!should_collide(proxy_data_[a].collider, proxy_data_[b].collider)) {
+        continue;
+      }
+
+      Narrowphase::Contact contact;
+      if (test(proxy_data_[a].shape, proxy_data_[b].shape, &contact)) {
+        handle_contact(a, b, contact);
+        ++hits;
       }
     }
   }
+  broadphase_->report_true_hits(hits);
 }
 
-bool CollisionSystem::check_collision(Entity *entity_a, Entity *entity_b, CollisionInfo *out_info) const {
-  if (!is_valid_entity(entity_a) || !is_valid_entity(entity_b)) {
-    return false;
-  }
+void CollisionSystem::build_proxies() {
+  proxies_.clear();
+  proxy_data_.clear();
 
-  auto *transform_a = entity_a->get_component<Components::Transform>();
-  auto *transform_b = entity_b->get_component<Components::Transform>();
-  auto *collider_a = entity_a->get_component<Collider>();
-  auto *collider_b = entity_b->get_component<Collider>();
+  for (Entity *entity : entities_) {
+    if (!is_valid_entity(entity)) {
+      continue;
+    }
 
-  if (!should_collide(collider_a, collider_b)) {
-    return false;
+    auto *transform = entity->get_component<Components::Transform>();
+    const auto *collider = entity->get_component<Collider>();
+    const Narrowphase::Shape shape = Narrowphase::make_shape(*transform, *collider);
+
+    const auto index = static_cast<std::uint32_t>(proxy_data_.size());
+    proxies_.push_back({Narrowphase::get_bounds(shape), index, transform->sleeping});
+    proxy_data_.push_back({entity, transform, collider, shape});
   }
+}
 
-  bool collision = false;
-  CollisionInfo temp_info;
-  temp_info.entity_a = entity_a;
-  temp_info.entity_b = entity_b;
-
-  if (collider_a->type == ColliderType::CIRCLE && collider_b->type == ColliderType::CIRCLE) {
-    collision = circle_vs_circle(transform_a->position, collider_a->radius, transform_b->position, collider_b->radius,
-                                 &temp_info);
-  } else if (collider_a->type == ColliderType::RECTANGLE && collider_b->type == ColliderType::RECTANGLE) {
-    collision = rect_vs_rect(transform_a->position, collider_a->size, transform_b->position, collider_b->size,
-                             &temp_info);
-  } else {
-    if (collider_a->type == ColliderType::CIRCLE) {
-      collision = circle_vs_rect(transform_a->position, collider_a->radius, transform_b->position, collider_b->size,
-                                 &temp_info);
-    } else {
-      collision = circle_vs_rect(transform_b->position, collider_b->radius, transform_a->position, collider_a->size,
-                                 &temp_info);
+void CollisionSystem::sort_pairs_by_shape() {
+  // Counting sort за індексом пари типів; A завжди має менший тип
+  shape_pair_offsets_.fill(0);
+  for (auto &[a, b] : pairs_) {
+    if (proxy_data_[a].shape.type > proxy_data_[b].shape.type) {
+      std::swap(a, b);
     }
+    ++shape_pair_offsets_[Narrowphase::pair_index(proxy_data_[a].shape.type, proxy_data_[b].shape.type) + 1];
   }
 
-  if (collision && out_info) {
-    *out_info = temp_info;
+  for (size_t bucket = 0; bucket < Narrowphase::PAIR_COUNT; ++bucket) {
+    shape_pair_offsets_[bucket + 1] += shape_pair_offsets_[bucket];
   }
 
-  return collision;
-}
+  std::array<size_t, Narrowphase::PAIR_COUNT> cursor;
+  std::copy_n(shape_pair_offsets_.begin(), Narrowphase::PAIR_COUNT, cursor.begin());
 
-bool CollisionSystem::circle_vs_circle(Vector2 pos_a, float radius_a, Vector2 pos_b, float radius_b,
-                                       CollisionInfo *out_info) const {
-  float dx = pos_b.x - pos_a.x;
-  float dy = pos_b.y - pos_a.y;
-  float distance_sq = dx * dx + dy * dy;
+  shape_pairs_.resize(pairs_.size());
+  for (const BroadphasePair &pair : pairs_) {
+    const size_t bucket = Narrowphase::pair_index(proxy_data_[pair.a].shape.type, proxy_data_[pair.b].shape.type);
+    shape_pairs_[cursor[bucket]++] = pair;
+  }
+}
 
-  float combined_radius = radius_a + radius_b;
-  float combined_radius_sq = combined_radius * combined_radius;
+void CollisionSystem::handle_contact(const std::uint32_t a, const std::uint32_t b, const Narrowphase::Contact &contact) {
+  ProxyData &data_a = proxy_data_[a];
+  ProxyData &data_b = proxy_data_[b];
 
-  if (distance_sq > combined_radius_sq) {
-    return false;
+  // Контакт з активним тілом будить сплячого
+  if (data_a.transform->sleeping != data_b.transform->sleeping) {
+    data_a.transform->wake();
+    data_b.transform->wake();
   }
 
-  if (out_info) {
-    float distance = std::sqrt(distance_sq);
+  const CollisionInfo info = {
+    data_a.entity, data_b.entity, contact.point, contact.normal, contact.penetration
+  };
 
-    if (distance > 0.0001f) {
-      out_info->collision_normal = Vector2(dx / distance, dy / distance);
-    } else {
-      out_info->collision_normal = Vector2(1.0f, 0.0f);
-    }
+  resolve_collision(info);
 
-    out_info->penetration_depth = combined_radius - distance;
-    out_info->collision_point = Vector2(pos_a.x + out_info->collision_normal.x * radius_a,
-                                        pos_a.y + out_info->collision_normal.y * radius_a);
+  // resolve_collision міг зсунути тіла — оновлюємо кешовані форми для наступних пар
+  data_a.shape.center = data_a.transform->position;
+  data_b.shape.center = data_b.transform->position;
+
+  for (const auto &callback: collision_callbacks_) {
+    callback(info);
   }
-  return true;
 }
 
-bool CollisionSystem::rect_vs_rect(Vector2 pos_a, Vector2 size_a, Vector2 pos_b, Vector2 size_b, CollisionInfo *out_info) const {
+void CollisionSystem::set_broadphase(const BroadphaseType type) {
+  if (broadphase_->get_type() == type) {
+    return;
+  }
 
-  Rectangle rect_a = {pos_a.x -size_a.x / 2.0f, pos_a.y - size_a.y / 2.0f, size_a.x, size_a.y};
-  Rectangle rect_b = {pos_b.x - size_b.x / 2.0f, pos_b.y - size_b.y / 2.0f, size_b.x, size_b.y};
+  broadphase_ = Broadphase::create(type, grid_cell_size_);
+  TRACELOG(LOG_INFO, "CollisionSystem broadphase switched to %s", to_string(type));
+}
 
-  bool collision = CheckCollisionRecs(rect_a, rect_b);
+void CollisionSystem::set_grid_cell_size(const float cell_size) {
+  grid_cell_size_ = cell_size;
+  if (broadphase_->get_type() == BroadphaseType::GRID) {
+    broadphase_ = Broadphase::create(BroadphaseType::GRID, grid_cell_size_);
+  }
+}
 
-  if (collision && out_info) {
-    out_info->collision_point = Vector2{(pos_a.x + pos_b.x)/2, (pos_a.y + pos_b.y)/2};
+void CollisionSystem::set_auto_tune(const bool enabled, const unsigned int sample_interval) {
+  auto_tune_ = enabled;
+  tuner_.set_sample_interval(sample_interval);
+}
 
-    float dx = pos_b.x - pos_a.x;
-    float dy = pos_b.y - pos_a.y;
-    float length = std::sqrt(dx * dx + dy * dy);
+void CollisionSystem::apply_broadphase_choice(const BroadphaseChoice &choice) {
+  // Невеликі коливання розміру клітинки не варті перебудови сітки
+  const bool cell_changed = std::abs(choice.cell_size - grid_cell_size_) > grid_cell_size_ * 0.25f;
+  if (choice.type == BroadphaseType::GRID && cell_changed) {
+    grid_cell_size_ = choice.cell_size;
+    broadphase_ = Broadphase::create(BroadphaseType::GRID, grid_cell_size_);
+    TRACELOG(LOG_INFO, "CollisionSystem auto-tune: Grid, cell size %.1f", grid_cell_size_);
+    return;
+  }
 
-    if (length > 0.0001f) {
-      out_info->collision_normal = Vector2(dx / length, dy / length);
-    }
+  set_broadphase(choice.type);
+}
 
-    out_info->penetration_depth = 1.f;
+bool CollisionSystem::check_collision(Entity *entity_a, Entity *entity_b, CollisionInfo *out_info) const {
+  if (!is_valid_entity(entity_a) || !is_valid_entity(entity_b)) {
+    return false;
   }
-  return collision;
-}
 
-bool CollisionSystem::circle_vs_rect(Vector2 circle_pos, float radius, Vector2 rect_pos, Vector2 rect_size, CollisionInfo *out_info) const {
-  float half_width = rect_size.x / 2.0f;
-  float half_height = rect_size.y / 2.0f;
+  const auto *collider_a = entity_a->get_component<Collider>();
+  const auto *collider_b = entity_b->get_component<Collider>();
+
+  if (!should_collide(collider_a, collider_b)) {
+    return false;
+  }
 
-  float closest_x = std::clamp(circle_pos.x, rect_pos.x - half_width, rect_pos.x + half_width);
-  float closest_y = std::clamp(circle_pos.y, rect_pos.y - half_height, rect_pos.y + half_height);
+  // Таблиця заповнена для впорядкованих пар типів
+  if (collider_a->type > collider_b->type) {
+    std::swap(entity_a, entity_b);
+    std::swap(collider_a, collider_b);
+  }
 
-  float dx = closest_x - circle_pos.x;
-  float dy = closest_y - circle_pos.y;
-  float distance_sq = dx * dx + dy * dy;
+  const Narrowphase::Shape shape_a = Narrowphase::make_shape(*entity_a->get_component<Components::Transform>(), *collider_a);
+  const Narrowphase::Shape shape_b = Narrowphase::make_shape(*entity_b->get_component<Components::Transform>(), *collider_b);
 
-  if (distance_sq > (radius * radius)) {
+  Narrowphase::Contact contact;
+  const Narrowphase::Test test = Narrowphase::DISPATCH_TABLE[Narrowphase::pair_index(shape_a.type, shape_b.type)];
+  if (!test(shape_a, shape_b, &contact)) {
     return false;
   }
 
   if (out_info) {
-    float distance = std::sqrt(distance_sq);
-
-    if (distance > 0.0001f) {
-      out_info->collision_normal = Vector2(dx / distance, dy / distance);
-    } else {
-      out_info->collision_normal = Vector2(0.0f, -1.0f);
-    }
-
-    out_info->penetration_depth = radius - distance;
-    out_info->collision_point = Vector2(closest_x, closest_y);
+    *out_info = CollisionInfo{entity_a, entity_b, contact.point, contact.normal, contact.penetration};
   }
   return true;
 }
@@ -198,26 +233,14 @@ void CollisionSystem::debug_draw() const {
     auto const *transform = entity->get_component<Components::Transform>();
     auto const *collider = entity->get_component<Components::Collider>();
 
-    if (collider->type == ColliderType::CIRCLE) {
-      DrawCircleLines(
-        static_cast<int>(transform->position.x),
-         static_cast<int>(transform->position.y),
-         collider->radius,
-         collider->debug_color);
-    } else {
-      const Rectangle rect = {
-        transform->position.x - collider->size.x / 2.0f,
-        transform->position.y - collider->size.y / 2.0f,
-        collider->size.x,
-        collider->size.y
-      };
-      DrawRectangleLinesEx(rect, 1.f, collider->debug_color);
-    }
+    Narrowphase::debug_draw(Narrowphase::make_shape(*transform, *collider), collider->debug_color);
   }
 }
 
 void CollisionSystem::clear_entities() {
   entities_.clear();
+  proxies_.clear();
+  proxy_data_.clear();
   TRACELOG(LOG_INFO, "CollisionSystem cleared all entities");
 }
 
@@ -4,11 +4,18 @@
 
 #ifndef BULBYK_COLLISIONSYSTEM_H
 #define BULBYK_COLLISIONSYSTEM_H
+#include <array>
 #include <functional>
+#include <memory>
+#include <vector>
 
 #include "raylib.h"
 #include "components/Collider.h"
+#include "components/Transform.h"
 #include "core/Entity.h"
+#include "systems/Narrowphase.h"
+#include "systems/broadphase/Broadphase.h"
+#include "systems/broadphase/BroadphaseTuner.h"
 
 
 struct CollisionInfo {
@@ -22,15 +29,41 @@ struct CollisionInfo {
 using CollisionCallback = std::function<void(const CollisionInfo&)>;
 
 class CollisionSystem {
+public:
+  static constexpr float DEFAULT_GRID_CELL_SIZE = 64.f;
+
 private:
   std::vector<Entity*> entities_;
   std::vector<CollisionCallback> collision_callbacks_;
 
+  float grid_cell_size_ = DEFAULT_GRID_CELL_SIZE;
+  std::unique_ptr<Broadphase> broadphase_;
+  BroadphaseTuner tuner_;
+  bool auto_tune_ = false;
+
+  struct ProxyData {
+    Entity* entity;
+    Components::Transform* transform;
+    const Components::Collider* collider;
+    Narrowphase::Shape shape;
+  };
+
+  // Кадрові буфери broadphase; індекс proxy = індекс у proxy_data_
+  std::vector<BroadphaseProxy> proxies_;
+  std::vector<ProxyData> proxy_data_;
+  std::vector<BroadphasePair> pairs_;
+
+  // Пари, згруповані за типами форм: пачка bucket лежить у [offsets[bucket], offsets[bucket + 1])
+  std::vector<BroadphasePair> shape_pairs_;
+  std::array<size_t, Narrowphase::PAIR_COUNT + 1> shape_pair_offsets_{};
+
 public:
-  CollisionSystem() = default;
+  CollisionSystem();
 
   void register_entity(Entity* entity);
   void unregister_entity(const Entity* entity);
+  // Резерв під очікувану кількість сутностей: список і кадрові буфери proxy не ростимуть у грі
+  void reserve(size_t capacity);
   void clear_entities();
 
   void update();
@@ -38,6 +71,13 @@ public:
   void add_collision_callback(CollisionCallback callback);
   void clear_collision_callbacks();
 
+  void set_broadphase(BroadphaseType type);
+  void set_grid_cell_size(float cell_size);
+  void set_auto_tune(bool enabled, unsigned int sample_interval = BroadphaseTuner::DEFAULT_SAMPLE_INTERVAL);
+
+  BroadphaseType get_broadphase_type() const { return broadphase_->get_type(); }
+  const BroadphaseStats& get_broadphase_stats() const { return broadphase_->get_stats(); }
+
   bool check_collision(Entity* entity_a, Entity* entity_b, CollisionInfo* out_info = nullptr) const;
 
   void resolve_collision (const CollisionInfo& info);
@@ -48,11 +88,10 @@ private:
   bool is_valid_entity(const Entity* entity) const;
   bool should_collide(const Components::Collider* a, const Components::Collider* b) const;
 
-  bool circle_vs_circle( Vector2 pos_a, float radius_a, Vector2 pos_b, float radius_b, CollisionInfo* out_info ) const;
-
-  bool rect_vs_rect(Vector2 pos_a, Vector2 size_a, Vector2 pos_b, Vector2 size_b, CollisionInfo* out_info) const;
-
-  bool circle_vs_rect(Vector2 pos_a, float radius_a, Vector2 pos_b, Vector2 size_b, CollisionInfo* out_info) const;
+  void build_proxies();
+  void sort_pairs_by_shape();
+  void handle_contact(std::uint32_t a, std::uint32_t b, const Narrowphase::Contact& contact);
+  void apply_broadphase_choice(const BroadphaseChoice& choice);
 };
 
 
@@ -0,0 +1,117 @@
+#include "CrowdSeparation.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "core/ThreadPool.h"
+
+namespace {
+
+// Золотий кут: агенти в одній точці розходяться кожен у свій бік, детерміновано за індексом
+constexpr float GOLDEN_ANGLE = 2.39996323f;
+constexpr float MIN_DISTANCE_SQUARED = 1e-6f;
+
+} // namespace
+
+CrowdSeparation::CrowdSeparation(const Rectangle bounds, const Settings &settings)
+  : settings_(settings)
+  , grid_(bounds, settings.cell_size) {
+}
+
+void CrowdSeparation::reserve(const size_t agent_count) {
+  grid_.reserve(agent_count);
+  positions_.reserve(agent_count);
+  radii_.reserve(agent_count);
+  resolved_.reserve(agent_count);
+}
+
+void CrowdSeparation::begin() {
+  positions_.clear();
+  radii_.clear();
+  max_radius_ = 0.f;
+}
+
+size_t CrowdSeparation::add(const Vector2 position, const float radius) {
+  positions_.push_back(position);
+  radii_.push_back(radius);
+  max_radius_ = std::max(max_radius_, radius);
+  return positions_.size() - 1;
+}
+
+void CrowdSeparation::solve(const float delta_time) {
+  const size_t count = positions_.size();
+  resolved_.resize(count);
+  if (count == 0) {
+    return;
+  }
+
+  grid_.build(positions_);
+  const float max_shift = settings_.max_speed * delta_time;
+
+  const size_t workers = pool_ ? pool_->get_thread_count() : 0;
+  if (workers == 0 || count < settings_.parallel_threshold) {
+    solve_range(0, count, max_shift);
+    return;
+  }
+
+  // Рівні діапазони на кожен робочий потік і один — на поточний, поки ті працюють
+  const size_t chunks = workers + 1;
+  const size_t chunk_size = (count + chunks - 1) / chunks;
+  pending_.clear();
+  for (size_t begin = chunk_size; begin < count; begin += chunk_size) {
+    const size_t end = std::min(count, begin + chunk_size);
+    pending_.push_back(pool_->submit([this, begin, end, max_shift] { solve_range(begin, end, max_shift); }));
+  }
+  solve_range(0, std::min(count, chunk_size), max_shift);
+
+  for (std::future<void> &task : pending_) {
+    task.get();
+  }
+  pending_.clear();
+}
+
+void CrowdSeparation::solve_range(const size_t begin, const size_t end, const float max_shift) {
+  for (size_t i = begin; i < end; ++i) {
+    const Vector2 position = positions_[i];
+    const float radius = radii_[i];
+    float push_x = 0.f;
+    float push_y = 0.f;
+    size_t neighbors = 0;
+
+    grid_.query(position, radius + max_radius_, [&](const std::uint32_t j) {
+      if (j == i) {
+        return true;
+      }
+
+      const float min_distance = radius + radii_[j];
+      const float dx = position.x - positions_[j].x;
+      const float dy = position.y - positions_[j].y;
+      const float distance_squared = dx * dx + dy * dy;
+      if (distance_squared >= min_distance * min_distance) {
+        return true;
+      }
+
+      if (distance_squared < MIN_DISTANCE_SQUARED) {
+        const float angle = GOLDEN_ANGLE * static_cast<float>(i);
+        push_x += std::cos(angle) * min_distance;
+        push_y += std::sin(angle) * min_distance;
+      } else {
+        const float distance = std::sqrt(distance_squared);
+        const float overlap = (min_distance - distance) / distance;
+        push_x += dx * overlap;
+        push_y += dy * overlap;
+      }
+      return ++neighbors < settings_.max_neighbors;
+    });
+
+    push_x *= settings_.relaxation;
+    push_y *= settings_.relaxation;
+    const float shift_squared = push_x * push_x + push_y * push_y;
+    if (shift_squared > max_shift * max_shift) {
+      const float scale = max_shift / std::sqrt(shift_squared);
+      push_x *= scale;
+      push_y *= scale;
+    }
+    resolved_[i] = {position.x + push_x, position.y + push_y};
+  }
+}
@@ -0,0 +1,336 @@
+#include "FlowField.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+
+namespace {
+
+constexpr int ORTHOGONAL[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+
+} // namespace
+
+FlowField::FlowField(const Rectangle bounds, const float cell_size)
+  : bounds_(bounds)
+  , cell_size_(std::max(1.f, cell_size))
+  , columns_(std::max(1, static_cast<int>(std::ceil(bounds.width / cell_size_))))
+  , rows_(std::max(1, static_cast<int>(std::ceil(bounds.height / cell_size_)))) {
+  const size_t cell_count = static_cast<size_t>(columns_) * rows_;
+  distance_.assign(cell_count, UNREACHABLE);
+  blocked_.assign(cell_count, 0);
+  direction_.assign(cell_count, Vector2{0.f, 0.f});
+  line_of_sight_.assign(cell_count, 0);
+  queue_.reserve(cell_count);
+  heap_.reserve(cell_count * 4);
+  touched_.reserve(cell_count);
+}
+
+bool FlowField::update(const Vector2 target) {
+  const int cell = cell_of(target);
+  if (cell == target_cell_) {
+    return false;
+  }
+
+  target_cell_ = cell;
+  built_ = false;
+  if (blocked_count_ == 0) {
+    return false;
+  }
+  rebuild();
+  return true;
+}
+
+void FlowField::set_blocked(const Vector2 position, const bool blocked) {
+  const int cell = cell_of(position);
+  if ((blocked_[cell] != 0) == blocked) {
+    return;
+  }
+
+  blocked_[cell] = blocked ? 1 : 0;
+  blocked_count_ = blocked ? blocked_count_ + 1 : blocked_count_ - 1;
+  reset_line_of_sight();
+  if (target_cell_ < 0) {
+    return;
+  }
+  if (!built_) {
+    if (blocked_count_ > 0) {
+      rebuild();
+    }
+    return;
+  }
+
+  touched_.clear();
+  touched_.push_back(static_cast<std::uint32_t>(cell));
+  // Клітинка цілі лишається джерелом поля навіть під перешкодою — відстані не змінюються
+  if (cell != target_cell_) {
+    if (blocked) {
+      raise_from(cell);
+    }
+    lower_from_touched();
+  }
+  refresh_directions();
+
+  ++stats_.incremental_updates;
+  stats_.cells_touched = touched_.size();
+}
+
+void FlowField::clear_obstacles() {
+  std::ranges::fill(blocked_, 0);
+  blocked_count_ = 0;
+  reset_line_of_sight();
+  // Без перешкод поле не підтримується — наступна перешкода збудує його заново
+  built_ = false;
+}
+
+Vector2 FlowField::sample(const Vector2 position) const {
+  return built_ ? direction_[cell_of(position)] : Vector2{0.f, 0.f};
+}
+
+bool FlowField::has_line_of_sight(const Vector2 position) const {
+  if (blocked_count_ == 0) {
+    return true;
+  }
+
+  const int cell = cell_of(position);
+  if (line_of_sight_[cell] == 0) {
+    line_of_sight_[cell] = trace_line_of_sight(cell) ? 1 : 2;
+  }
+  return line_of_sight_[cell] == 1;
+}
+
+std::uint32_t FlowField::get_distance(const Vector2 position) const {
+  return built_ ? distance_[cell_of(position)] : UNREACHABLE;
+}
+
+bool FlowField::is_blocked(const Vector2 position) const {
+  return blocked_[cell_of(position)] != 0;
+}
+
+int FlowField::cell_of(const Vector2 position) const {
+  // Точки поза світом (напр. вороги на смузі спавну) належать крайнім клітинкам
+  const int column = std::clamp(static_cast<int>((position.x - bounds_.x) / cell_size_), 0, columns_ - 1);
+  const int row = std::clamp(static_cast<int>((position.y - bounds_.y) / cell_size_), 0, rows_ - 1);
+  return row * columns_ + column;
+}
+
+Vector2 FlowField::center_of(const int cell) const {
+  return {bounds_.x + (static_cast<float>(cell % columns_) + 0.5f) * cell_size_,
+          bounds_.y + (static_cast<float>(cell / columns_) + 0.5f) * cell_size_};
+}
+
+void FlowField::rebuild() {
+  std::ranges::fill(distance_, UNREACHABLE);
+  distance_[target_cell_] = 0;
+
+  queue_.clear();
+  queue_.push_back(static_cast<std::uint32_t>(target_cell_));
+  for (size_t head = 0; head < queue_.size(); ++head) {
+    const int cell = static_cast<int>(queue_[head]);
+    const int x = cell % columns_;
+    const int y = cell / columns_;
+    for (const auto &[dx, dy] : ORTHOGONAL) {
+      const int nx = x + dx;
+      const int ny = y + dy;
+      if (nx < 0 || ny < 0 || nx >= columns_ || ny >= rows_) continue;
+
+      const int neighbor = ny * columns_ + nx;
+      if (blocked_[neighbor] || distance_[neighbor] != UNREACHABLE) continue;
+      distance_[neighbor] = distance_[cell] + 1;
+      queue_.push_back(static_cast<std::uint32_t>(neighbor));
+    }
+  }
+
+  for (int cell = 0; cell < columns_ * rows_; ++cell) {
+    compute_direction(cell);
+  }
+  reset_line_of_sight();
+  built_ = true;
+
+  ++stats_.full_rebuilds;
+  stats_.cells_touched = distance_.size();
+}
+
+void FlowField::raise_from(const int cell) {
+  // Нова перешкода: скидаємо відстані всіх клітинок, чия відстань трималася лише на шляху через неї.
+  // heap_ тут служить звичайною чергою пар (стара відстань, клітинка)
+  heap_.clear();
+  heap_.emplace_back(distance_[cell], static_cast<std::uint32_t>(cell));
+  distance_[cell] = UNREACHABLE;
+
+  for (size_t head = 0; head < heap_.size(); ++head) {
+    const auto [old_distance, current] = heap_[head];
+    if (old_distance == UNREACHABLE) continue;
+
+    const int x = static_cast<int>(current) % columns_;
+    const int y = static_cast<int>(current) / columns_;
+    for (const auto &[dx, dy] : ORTHOGONAL) {
+      const int nx = x + dx;
+      const int ny = y + dy;
+      if (nx < 0 || ny < 0 || nx >= columns_ || ny >= rows_) continue;
+
+      const int neighbor = ny * columns_ + nx;
+      if (blocked_[neighbor] || neighbor == target_cell_ || distance_[neighbor] != old_distance + 1) continue;
+
+      // Сусід з відстанню на крок меншою ще тримає клітинку — її відстань не змінюється
+      bool supported = false;
+      for (const auto &[sx, sy] : ORTHOGONAL) {
+        const int mx = nx + sx;
+        const int my = ny + sy;
+        if (mx < 0 || my < 0 || mx >= columns_ || my >= rows_) continue;
+        if (distance_[my * columns_ + mx] == old_distance) {
+          supported = true;
+          break;
+        }
+      }
+      if (supported) continue;
+
+      heap_.emplace_back(distance_[neighbor], static_cast<std::uint32_t>(neighbor));
+      distance_[neighbor] = UNREACHABLE;
+      touched_.push_back(static_cast<std::uint32_t>(neighbor));
+    }
+  }
+}
+
+void FlowField::lower_from_touched() {
+  // Скинуті й звільнені клітинки отримують відстані від уцілілих сусідів — Дейкстра від цієї межі
+  heap_.clear();
+  for (const std::uint32_t cell : touched_) {
+    if (blocked_[cell]) continue;
+
+    const int x = static_cast<int>(cell) % columns_;
+    const int y = static_cast<int>(cell) / columns_;
+    for (const auto &[dx, dy] : ORTHOGONAL) {
+      const int nx = x + dx;
+      const int ny = y + dy;
+      if (nx < 0 || ny < 0 || nx >= columns_ || ny >= rows_) continue;
+
+      const int neighbor = ny * columns_ + nx;
+      if (distance_[neighbor] != UNREACHABLE && (!blocked_[neighbor] || neighbor == target_cell_)) {
+        heap_.emplace_back(distance_[neighbor], static_cast<std::uint32_t>(neighbor));
+      }
+    }
+  }
+  std::ranges::make_heap(heap_, std::greater<>{});
+  propagate();
+}
+
+void FlowField::propagate() {
+  while (!heap_.empty()) {
+    std::ranges::pop_heap(heap_, std::greater<>{});
+    const auto [cell_distance, cell] = heap_.back();
+    heap_.pop_back();
+    if (cell_distance != distance_[cell]) continue;
+
+    const int x = static_cast<int>(cell) % columns_;
+    const int y = static_cast<int>(cell) / columns_;
+    for (const auto &[dx, dy] : ORTHOGONAL) {
+      const int nx = x + dx;
+      const int ny = y + dy;
+      if (nx < 0 || ny < 0 || nx >= columns_ || ny >= rows_) continue;
+
+      const int neighbor = ny * columns_ + nx;
+      if (blocked_[neighbor] || cell_distance + 1 >= distance_[neighbor]) continue;
+      distance_[neighbor] = cell_distance + 1;
+      touched_.push_back(static_cast<std::uint32_t>(neighbor));
+      heap_.emplace_back(distance_[neighbor], static_cast<std::uint32_t>(neighbor));
+      std::ranges::push_heap(heap_, std::greater<>{});
+    }
+  }
+}
+
+void FlowField::refresh_directions() {
+  // Напрямок залежить від відстаней восьми сусідів, тож оновлюємо і їх
+  for (const std::uint32_t cell : touched_) {
+    const int x = static_cast<int>(cell) % columns_;
+    const int y = static_cast<int>(cell) / columns_;
+    for (int ny = std::max(0, y - 1); ny <= std::min(rows_ - 1, y + 1); ++ny) {
+      for (int nx = std::max(0, x - 1); nx <= std::min(columns_ - 1, x + 1); ++nx) {
+        compute_direction(ny * columns_ + nx);
+      }
+    }
+  }
+}
+
+void FlowField::compute_direction(const int cell) {
+  direction_[cell] = {0.f, 0.f};
+  if (cell == target_cell_ || distance_[cell] == UNREACHABLE) {
+    return;
+  }
+
+  const int x = cell % columns_;
+  const int y = cell / columns_;
+  const auto passable = [this](const int px, const int py) {
+    return px >= 0 && py >= 0 && px < columns_ && py < rows_ &&
+           (!blocked_[py * columns_ + px] || py * columns_ + px == target_cell_);
+  };
+
+  std::uint32_t best = distance_[cell];
+  int best_cell = -1;
+  for (int dy = -1; dy <= 1; ++dy) {
+    for (int dx = -1; dx <= 1; ++dx) {
+      if ((dx == 0 && dy == 0) || !passable(x + dx, y + dy)) continue;
+      // По діагоналі — лише коли обидві прилеглі клітинки вільні, інакше агент зрізав би кут перешкоди
+      if (dx != 0 && dy != 0 && (!passable(x + dx, y) || !passable(x, y + dy))) continue;
+
+      const int neighbor = (y + dy) * columns_ + (x + dx);
+      if (distance_[neighbor] < best) {
+        best = distance_[neighbor];
+        best_cell = neighbor;
+      }
+    }
+  }
+
+  if (best_cell >= 0) {
+    const Vector2 from = center_of(cell);
+    const Vector2 to = center_of(best_cell);
+    const float dx = to.x - from.x;
+    const float dy = to.y - from.y;
+    const float length = std::sqrt(dx * dx + dy * dy);
+    direction_[cell] = {dx / length, dy / length};
+  }
+}
+
+void FlowField::reset_line_of_sight() {
+  std::ranges::fill(line_of_sight_, 0);
+}
+
+bool FlowField::trace_line_of_sight(const int cell) const {
+  if (target_cell_ < 0) {
+    return false;
+  }
+
+  // Брезенгем по клітинках; на діагональному кроці перевіряються обидві сусідні клітинки,
+  // щоб промінь не прослизав між перешкодами, що торкаються кутами
+  int x = cell % columns_;
+  int y = cell / columns_;
+  const int end_x = target_cell_ % columns_;
+  const int end_y = target_cell_ / columns_;
+  const int step_x = x < end_x ? 1 : -1;
+  const int step_y = y < end_y ? 1 : -1;
+  const int delta_x = std::abs(end_x - x);
+  const int delta_y = -std::abs(end_y - y);
+  int error = delta_x + delta_y;
+
+  while (x != end_x || y != end_y) {
+    if (blocked_[y * columns_ + x]) {
+      return false;
+    }
+
+    const int doubled = 2 * error;
+    const bool move_x = doubled >= delta_y;
+    const bool move_y = doubled <= delta_x;
+    if (move_x && move_y && (blocked_[y * columns_ + x + step_x] || blocked_[(y + step_y) * columns_ + x])) {
+      return false;
+    }
+    if (move_x) {
+      error += delta_y;
+      x += step_x;
+    }
+    if (move_y) {
+      error += delta_x;
+      y += step_y;
+    }
+  }
+  return true;
+}
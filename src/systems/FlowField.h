@@ -0,0 +1,83 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "raylib.h"
+
+// Спільне поле напрямків до однієї цілі на рівномірній сітці світу. Інтеграційне поле — BFS-відстань
+// у кроках (4-зв'язність) від клітинки цілі; напрямок клітинки веде до сусіда (8-зв'язність, без зрізання кутів)
+// з найменшою відстанню. Поле перераховується повністю лише тоді, коли ціль переходить в іншу клітинку;
+// зміна перешкоди оновлює тільки зачеплену частину. Вартість не залежить від кількості агентів.
+// Без перешкод поле не потрібне (кожен бачить ціль), тож воно не будується зовсім: перша перешкода
+// будує його повністю, далі — інкрементно. Доки поле не побудоване, sample дає нуль, а get_distance — UNREACHABLE
+class FlowField {
+public:
+  static constexpr std::uint32_t UNREACHABLE = UINT32_MAX;
+
+  struct Stats {
+    size_t full_rebuilds = 0;
+    size_t incremental_updates = 0;
+    size_t cells_touched = 0;   // Клітинок, змінених останнім оновленням
+  };
+
+private:
+  Rectangle bounds_;
+  float cell_size_;
+  int columns_;
+  int rows_;
+
+  std::vector<std::uint32_t> distance_;
+  std::vector<std::uint8_t> blocked_;
+  std::vector<Vector2> direction_;
+  size_t blocked_count_ = 0;
+  int target_cell_ = -1;
+  bool built_ = false;
+
+  // Пряма видимість цілі з клітинки, рахується ліниво: 0 — невідомо, 1 — є, 2 — немає
+  mutable std::vector<std::uint8_t> line_of_sight_;
+
+  // Робочі буфери переживають оновлення: черга BFS, купа (відстань, клітинка) і змінені клітинки
+  std::vector<std::uint32_t> queue_;
+  std::vector<std::pair<std::uint32_t, std::uint32_t>> heap_;
+  std::vector<std::uint32_t> touched_;
+
+  Stats stats_;
+
+public:
+  FlowField(Rectangle bounds, float cell_size);
+
+  // Переносить ціль; true, якщо поле довелося перерахувати (ціль змінила клітинку, а перешкоди є)
+  bool update(Vector2 target);
+  // Позначає клітинку під position прохідною чи ні і оновлює лише зачеплену частину поля
+  void set_blocked(Vector2 position, bool blocked);
+  void clear_obstacles();
+
+  // Одиничний напрямок руху з position; нуль у клітинці цілі та там, звідки цілі не дістатись
+  [[nodiscard]] Vector2 sample(Vector2 position) const;
+  // Чи видно ціль по прямій — тоді агенту не потрібне поле, досить іти на ціль
+  [[nodiscard]] bool has_line_of_sight(Vector2 position) const;
+  [[nodiscard]] std::uint32_t get_distance(Vector2 position) const;
+  [[nodiscard]] bool is_blocked(Vector2 position) const;
+  [[nodiscard]] bool has_obstacles() const { return blocked_count_ > 0; }
+  [[nodiscard]] bool is_built() const { return built_; }
+
+  [[nodiscard]] float get_cell_size() const { return cell_size_; }
+  [[nodiscard]] int get_columns() const { return columns_; }
+  [[nodiscard]] int get_rows() const { return rows_; }
+  [[nodiscard]] const Stats& get_stats() const { return stats_; }
+
+private:
+  int cell_of(Vector2 position) const;
+  Vector2 center_of(int cell) const;
+
+  void rebuild();
+  void raise_from(int cell);
+  void lower_from_touched();
+  void propagate();
+  void refresh_directions();
+  void compute_direction(int cell);
+  void reset_line_of_sight();
+  bool trace_line_of_sight(int cell) const;
+};
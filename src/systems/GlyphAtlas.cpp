@@ -0,0 +1,239 @@
+#include "GlyphAtlas.h"
+
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#include "utils.h"
+#include "render/RenderBackend.h"
+
+namespace {
+
+constexpr char CACHE_MAGIC[4] = {'B', 'G', 'L', 'Y'};
+constexpr std::uint32_t CACHE_VERSION = 1;
+
+struct CacheHeader {
+  char magic[4];
+  std::uint32_t version;
+  std::int32_t base_size;
+  std::uint32_t glyph_count;
+};
+
+struct CacheGlyph {
+  std::int32_t value;
+  std::int32_t offset_x;
+  std::int32_t offset_y;
+  std::int32_t advance_x;
+  Rectangle rec;
+};
+
+constexpr std::uint64_t FNV_OFFSET = 14695981039346656037ull;
+constexpr std::uint64_t FNV_PRIME = 1099511628211ull;
+
+void hash_bytes(std::uint64_t &hash, const void *data, const size_t size) {
+  const auto *bytes = static_cast<const unsigned char*>(data);
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= bytes[i];
+    hash *= FNV_PRIME;
+  }
+}
+
+// Системні шрифти з кирилицею, якщо гра не постачає власного
+constexpr std::array<const char*, 5> SYSTEM_FONTS = {
+  "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
+  "/usr/share/fonts/TTF/DejaVuSans.ttf",
+  "/usr/share/fonts/dejavu/DejaVuSans.ttf",
+  "/System/Library/Fonts/Supplemental/Arial.ttf",
+  "C:/Windows/Fonts/arial.ttf",
+};
+
+} // namespace
+
+GlyphAtlas::~GlyphAtlas() {
+  unload();
+}
+
+bool GlyphAtlas::load(const std::string &font_path, const std::vector<int> &codepoints,
+                      const std::string &cache_directory, const int base_size) {
+  unload();
+
+  if (font_path.empty() || !FileExists(font_path.c_str()) || codepoints.empty()) {
+    TRACELOG(LOG_WARNING, "GlyphAtlas: font '%s' not found, using built-in ASCII font", font_path.c_str());
+    return false;
+  }
+
+  char key[17];
+  std::snprintf(key, sizeof(key), "%016llx", static_cast<unsigned long long>(get_cache_key(font_path, codepoints, base_size)));
+  const std::string base_path = cache_directory + "glyphs_" + key;
+  const std::string image_path = base_path + ".png";
+  const std::string metrics_path = base_path + ".bin";
+
+  if (load_cache(image_path, metrics_path, base_size, codepoints.size())) {
+    TRACELOG(LOG_INFO, "GlyphAtlas: %zu glyphs loaded from cache '%s'", glyphs_.size(), image_path.c_str());
+    return true;
+  }
+
+  std::error_code error;
+  std::filesystem::create_directories(cache_directory, error);
+  if (!rasterize(font_path, codepoints, base_size, image_path, metrics_path)) {
+    TRACELOG(LOG_WARNING, "GlyphAtlas: failed to rasterize '%s', using built-in ASCII font", font_path.c_str());
+    unload();
+    return false;
+  }
+
+  TRACELOG(LOG_INFO, "GlyphAtlas: %zu glyphs rasterized from '%s' (%dx%d atlas)",
+           glyphs_.size(), font_path.c_str(), font_.texture.width, font_.texture.height);
+  return true;
+}
+
+void GlyphAtlas::unload() {
+  if (font_.texture.id != 0) {
+    RenderBackend::get().unload_texture(font_.texture);
+  }
+  font_ = Font{};
+  glyphs_.clear();
+  recs_.clear();
+}
+
+std::string GlyphAtlas::find_font(const std::string &application_directory) {
+  if (const std::string bundled = application_directory + "fonts/ui.ttf"; FileExists(bundled.c_str())) {
+    return bundled;
+  }
+  for (const char *path : SYSTEM_FONTS) {
+    if (FileExists(path)) {
+      return path;
+    }
+  }
+  return {};
+}
+
+bool GlyphAtlas::load_cache(const std::string &image_path, const std::string &metrics_path,
+                            const int base_size, const size_t glyph_count) {
+  std::ifstream input(metrics_path, std::ios::binary);
+  if (!input || !FileExists(image_path.c_str())) {
+    return false;
+  }
+
+  CacheHeader header{};
+  input.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if (!input || std::memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0 || header.version != CACHE_VERSION
+      || header.base_size != base_size || header.glyph_count != glyph_count) {
+    return false;
+  }
+
+  std::vector<CacheGlyph> cached(header.glyph_count);
+  input.read(reinterpret_cast<char*>(cached.data()), static_cast<std::streamsize>(cached.size() * sizeof(CacheGlyph)));
+  if (!input) {
+    return false;
+  }
+
+  glyphs_.resize(cached.size());
+  recs_.resize(cached.size());
+  for (size_t i = 0; i < cached.size(); ++i) {
+    const CacheGlyph &glyph = cached[i];
+    // Зображення окремих гліфів потрібні лише для побудови атласу, у кеші їх немає
+    glyphs_[i] = GlyphInfo{glyph.value, glyph.offset_x, glyph.offset_y, glyph.advance_x, Image{}};
+    recs_[i] = glyph.rec;
+  }
+
+  const Image atlas = LoadImage(image_path.c_str());
+  if (!IsImageValid(atlas)) {
+    return false;
+  }
+  const bool uploaded = upload(atlas, base_size);
+  UnloadImage(atlas);
+  return uploaded;
+}
+
+bool GlyphAtlas::rasterize(const std::string &font_path, const std::vector<int> &codepoints, const int base_size,
+                           const std::string &image_path, const std::string &metrics_path) {
+  int file_size = 0;
+  unsigned char *file_data = LoadFileData(font_path.c_str(), &file_size);
+  if (!file_data) {
+    return false;
+  }
+
+  const auto count = static_cast<int>(codepoints.size());
+  std::vector<int> request = codepoints;
+  GlyphInfo *glyphs = LoadFontData(file_data, file_size, base_size, request.data(), count, FONT_DEFAULT);
+  UnloadFileData(file_data);
+  if (!glyphs) {
+    return false;
+  }
+
+  Rectangle *recs = nullptr;
+  const Image atlas = GenImageFontAtlas(glyphs, &recs, count, base_size, GLYPH_PADDING, 0);
+
+  glyphs_.resize(codepoints.size());
+  recs_.resize(codepoints.size());
+  for (int i = 0; i < count; ++i) {
+    glyphs_[i] = GlyphInfo{glyphs[i].value, glyphs[i].offsetX, glyphs[i].offsetY, glyphs[i].advanceX, Image{}};
+    recs_[i] = recs ? recs[i] : Rectangle{};
+  }
+  UnloadFontData(glyphs, count);
+  MemFree(recs);
+
+  if (!IsImageValid(atlas) || !recs) {
+    UnloadImage(atlas);
+    return false;
+  }
+
+  // Кеш пишемо до вивантаження на GPU: наступний запуск не відкриватиме TTF взагалі
+  if (ExportImage(atlas, image_path.c_str())) {
+    CacheHeader header{};
+    std::memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    header.version = CACHE_VERSION;
+    header.base_size = base_size;
+    header.glyph_count = static_cast<std::uint32_t>(glyphs_.size());
+
+    std::ofstream output(metrics_path, std::ios::binary | std::ios::trunc);
+    output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (size_t i = 0; i < glyphs_.size(); ++i) {
+      const GlyphInfo &glyph = glyphs_[i];
+      const CacheGlyph cached{glyph.value, glyph.offsetX, glyph.offsetY, glyph.advanceX, recs_[i]};
+      output.write(reinterpret_cast<const char*>(&cached), sizeof(cached));
+    }
+    if (!output) {
+      TRACELOG(LOG_WARNING, "GlyphAtlas: can't write cache '%s'", metrics_path.c_str());
+    }
+  }
+
+  const bool uploaded = upload(atlas, base_size);
+  UnloadImage(atlas);
+  return uploaded;
+}
+
+bool GlyphAtlas::upload(const Image &atlas, const int base_size) {
+  RenderBackend &backend = RenderBackend::get();
+  const Texture2D texture = backend.load_texture(atlas);
+  if (texture.id == 0) {
+    return false;
+  }
+  // Атлас растеризований крупніше за HUD, тож при зменшенні потрібна фільтрація
+  backend.set_texture_filter(texture, TEXTURE_FILTER_BILINEAR);
+
+  font_.baseSize = base_size;
+  font_.glyphCount = static_cast<int>(glyphs_.size());
+  font_.glyphPadding = GLYPH_PADDING;
+  font_.texture = texture;
+  font_.recs = recs_.data();
+  font_.glyphs = glyphs_.data();
+  return true;
+}
+
+std::uint64_t GlyphAtlas::get_cache_key(const std::string &font_path, const std::vector<int> &codepoints,
+                                        const int base_size) {
+  // Ключ змінюється разом зі шрифтом, набором символів і розміром — старий кеш просто не підхопиться
+  std::uint64_t hash = FNV_OFFSET;
+  const long modified = GetFileModTime(font_path.c_str());
+  const int length = GetFileLength(font_path.c_str());
+  hash_bytes(hash, font_path.data(), font_path.size());
+  hash_bytes(hash, &modified, sizeof(modified));
+  hash_bytes(hash, &length, sizeof(length));
+  hash_bytes(hash, &base_size, sizeof(base_size));
+  hash_bytes(hash, &GLYPH_PADDING, sizeof(GLYPH_PADDING));
+  hash_bytes(hash, codepoints.data(), codepoints.size() * sizeof(int));
+  return hash;
+}
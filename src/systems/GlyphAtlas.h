@@ -0,0 +1,45 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "raylib.h"
+
+// Шрифт лише з потрібними гліфами: набір кодпоінтів приходить з каталогів перекладів,
+// TTF растеризується один раз, а атлас (PNG + метрики) кешується на диску між запусками
+class GlyphAtlas {
+public:
+  static constexpr int DEFAULT_BASE_SIZE = 32;
+  static constexpr int GLYPH_PADDING = 4;
+
+private:
+  Font font_{};
+  std::vector<GlyphInfo> glyphs_;
+  std::vector<Rectangle> recs_;
+
+public:
+  GlyphAtlas() = default;
+  ~GlyphAtlas();
+
+  GlyphAtlas(const GlyphAtlas&) = delete;
+  GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+
+  // Спершу кеш, потім растеризація TTF; false — шрифт недоступний і лишається вбудований ASCII
+  bool load(const std::string &font_path, const std::vector<int> &codepoints,
+            const std::string &cache_directory, int base_size = DEFAULT_BASE_SIZE);
+  void unload();
+
+  [[nodiscard]] bool is_loaded() const { return font_.texture.id != 0; }
+  [[nodiscard]] const Font& get_font() const { return font_; }
+  [[nodiscard]] size_t get_glyph_count() const { return glyphs_.size(); }
+
+  // Перший наявний TTF з кирилицею: поруч з грою (fonts/ui.ttf), далі системні шрифти
+  static std::string find_font(const std::string &application_directory);
+
+private:
+  bool load_cache(const std::string &image_path, const std::string &metrics_path, int base_size, size_t glyph_count);
+  bool rasterize(const std::string &font_path, const std::vector<int> &codepoints, int base_size,
+                 const std::string &image_path, const std::string &metrics_path);
+  bool upload(const Image &atlas, int base_size);
+  static std::uint64_t get_cache_key(const std::string &font_path, const std::vector<int> &codepoints, int base_size);
+};
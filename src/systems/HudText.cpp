@@ -0,0 +1,111 @@
+#include "HudText.h"
+
+#include <algorithm>
+
+#include "RenderCommandBuffer.h"
+
+HudLabel::HudLabel(const Vector2 position, const int font_size, const Color color, const HudAlign align)
+  : position_{position}
+  , font_size_{font_size}
+  , color_{color}
+  , align_{align} {
+}
+
+void HudLabel::set_position(const Vector2 position) {
+  const Vector2 delta = {position.x - position_.x, position.y - position_.y};
+  position_ = position;
+
+  // Розкладка від позиції не залежить — просто зсуваємо готові квади
+  for (GlyphQuad &quad : quads_) {
+    quad.dest.x += delta.x;
+    quad.dest.y += delta.y;
+  }
+}
+
+void HudLabel::set_color(const Color color) {
+  color_ = color;
+  for (GlyphQuad &quad : quads_) {
+    quad.color = color;
+  }
+}
+
+void HudLabel::record(RenderCommandBuffer &commands, const int layer) const {
+  commands.add_glyphs(quads_.data(), quads_.size(), layer);
+}
+
+void HudLabel::layout(const std::string_view text) {
+  text_.assign(text);
+  quads_.clear();
+  ++layout_count_;
+
+  // Ті самі правила, що й у DrawText: мінімальний розмір 10, інтервал — розмір / 10
+  constexpr int default_font_size = 10;
+  const int font_size = std::max(font_size_, default_font_size);
+  const auto spacing = static_cast<float>(font_size / default_font_size);
+
+  const Font font = RenderBackend::get().get_font();
+  const bool has_metrics = font.glyphs != nullptr && font.recs != nullptr && font.baseSize > 0;
+  const float scale = has_metrics ? static_cast<float>(font_size) / static_cast<float>(font.baseSize) : 1.f;
+  const float line_height = has_metrics ? static_cast<float>(font.baseSize) * 1.5f * scale : static_cast<float>(font_size) * 1.5f;
+  const auto padding = has_metrics ? static_cast<float>(font.glyphPadding) : 0.f;
+
+  float x = 0.f;
+  float y = 0.f;
+  float width = 0.f;
+
+  for (size_t i = 0; i < text_.size();) {
+    int codepoint_size = 0;
+    const int codepoint = GetCodepointNext(text_.c_str() + i, &codepoint_size);
+    i += static_cast<size_t>(std::max(codepoint_size, 1));
+
+    if (codepoint == '\n') {
+      width = std::max(width, x - spacing);
+      x = 0.f;
+      y += line_height;
+      continue;
+    }
+
+    // Без метрик (null-бекенд) — моноширинне наближення, кількість квадів та сама
+    if (!has_metrics) {
+      if (codepoint != ' ' && codepoint != '\t') {
+        quads_.push_back({
+          Rectangle{0, 0, 0, 0},
+          Rectangle{x, y, static_cast<float>(font_size) * 0.5f, static_cast<float>(font_size)},
+          color_
+        });
+      }
+      x += static_cast<float>(font_size) * 0.5f + spacing;
+      continue;
+    }
+
+    const int index = GetGlyphIndex(font, codepoint);
+    const Rectangle &rec = font.recs[index];
+    const GlyphInfo &glyph = font.glyphs[index];
+
+    if (codepoint != ' ' && codepoint != '\t') {
+      quads_.push_back({
+        Rectangle{rec.x - padding, rec.y - padding, rec.width + 2.f * padding, rec.height + 2.f * padding},
+        Rectangle{
+          x + (static_cast<float>(glyph.offsetX) - padding) * scale,
+          y + (static_cast<float>(glyph.offsetY) - padding) * scale,
+          (rec.width + 2.f * padding) * scale,
+          (rec.height + 2.f * padding) * scale
+        },
+        color_
+      });
+    }
+
+    const float advance = glyph.advanceX == 0 ? rec.width : static_cast<float>(glyph.advanceX);
+    x += advance * scale + spacing;
+  }
+  width_ = std::max(width, x > 0.f ? x - spacing : 0.f);
+
+  // Як DrawText — цілочисельна позиція; центрування теж за цілою шириною, як з MeasureText
+  const float origin_x = align_ == HudAlign::CENTER
+                           ? position_.x - static_cast<float>(static_cast<int>(width_) / 2)
+                           : position_.x;
+  for (GlyphQuad &quad : quads_) {
+    quad.dest.x += origin_x;
+    quad.dest.y += position_.y;
+  }
+}
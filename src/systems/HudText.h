@@ -0,0 +1,89 @@
+#pragma once
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include "raylib.h"
+#include "render/RenderBackend.h"
+
+class RenderCommandBuffer;
+
+enum class HudAlign {
+  LEFT,
+  CENTER   // position.x — центр рядка
+};
+
+// Рядок HUD з кешованою розкладкою: гліфи і ширина рахуються лише при зміні тексту,
+// а щокадру в буфер команд копіюються готові квади
+class HudLabel {
+public:
+  // Вище за решту екранних команд — увесь HUD-текст стоїть поруч після сортування і йде одним пакетом
+  static constexpr int DEFAULT_LAYER = 1000;
+
+protected:
+  Vector2 position_;
+  int font_size_;
+  Color color_;
+  HudAlign align_;
+
+  std::string text_;
+  std::vector<GlyphQuad> quads_;
+  float width_ = 0.f;
+  size_t layout_count_ = 0;
+
+public:
+  HudLabel(Vector2 position, int font_size, Color color, HudAlign align = HudAlign::LEFT);
+
+  void set_position(Vector2 position);
+  void set_color(Color color);
+
+  void record(RenderCommandBuffer &commands, int layer = DEFAULT_LAYER) const;
+
+  const std::string& get_text() const { return text_; }
+  float get_width() const { return width_; }
+  // Скільки разів рядок перерозкладався — для перевірки, що кеш працює
+  size_t get_layout_count() const { return layout_count_; }
+
+protected:
+  void layout(std::string_view text);
+};
+
+// Рядок, прив'язаний до значень формату. Перерозкладка — лише коли змінилось хоч одне значення;
+// локалізовані рядки передаються як const char* з таблиці перекладів, тож зміна мови міняє вказівник
+template <typename... Args>
+class HudText : public HudLabel {
+private:
+  const char *format_;
+  std::tuple<Args...> values_{};
+  bool bound_ = false;
+
+public:
+  HudText(const char *format, const Vector2 position, const int font_size, const Color color,
+          const HudAlign align = HudAlign::LEFT)
+    : HudLabel(position, font_size, color, align)
+    , format_(format) {
+  }
+
+  // Формат теж може залежати від мови
+  void set_format(const char *format) {
+    if (format != format_) {
+      format_ = format;
+      bound_ = false;
+    }
+  }
+
+  void set(const Args &... args) {
+    if (bound_ && values_ == std::tie(args...)) {
+      return;
+    }
+    values_ = std::tuple<Args...>(args...);
+    bound_ = true;
+
+    char buffer[256];
+    const int length = std::snprintf(buffer, sizeof(buffer), format_, args...);
+    layout(length < 0 ? std::string_view{} : std::string_view(buffer, std::min<size_t>(length, sizeof(buffer) - 1)));
+  }
+};
@@ -0,0 +1,428 @@
+#include "Narrowphase.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "render/RenderBackend.h"
+
+using Components::ColliderType;
+
+namespace {
+  constexpr float EPSILON = 0.0001f;
+
+  Vector2 add(const Vector2 a, const Vector2 b) { return Vector2{a.x + b.x, a.y + b.y}; }
+  Vector2 sub(const Vector2 a, const Vector2 b) { return Vector2{a.x - b.x, a.y - b.y}; }
+  Vector2 scale(const Vector2 v, const float s) { return Vector2{v.x * s, v.y * s}; }
+  float dot(const Vector2 a, const Vector2 b) { return a.x * b.x + a.y * b.y; }
+
+  Vector2 to_local(const Narrowphase::Shape &box, const Vector2 point) {
+    const Vector2 d = sub(point, box.center);
+    return Vector2{dot(d, box.axis_x), dot(d, box.axis_y)};
+  }
+
+  Vector2 to_world_direction(const Narrowphase::Shape &box, const Vector2 local) {
+    return add(scale(box.axis_x, local.x), scale(box.axis_y, local.y));
+  }
+
+  Vector2 segment_start(const Narrowphase::Shape &capsule) {
+    return sub(capsule.center, scale(capsule.axis_x, capsule.half_length));
+  }
+
+  Vector2 segment_end(const Narrowphase::Shape &capsule) {
+    return add(capsule.center, scale(capsule.axis_x, capsule.half_length));
+  }
+
+  Vector2 closest_point_on_segment(const Vector2 start, const Vector2 end, const Vector2 point) {
+    const Vector2 segment = sub(end, start);
+    const float length_sq = dot(segment, segment);
+    if (length_sq < EPSILON) {
+      return start;
+    }
+    const float t = std::clamp(dot(sub(point, start), segment) / length_sq, 0.0f, 1.0f);
+    return add(start, scale(segment, t));
+  }
+
+  // Ericson, Real-Time Collision Detection, 5.1.9
+  void closest_points_between_segments(const Vector2 p1, const Vector2 q1, const Vector2 p2, const Vector2 q2,
+                                       Vector2 *out_a, Vector2 *out_b) {
+    const Vector2 d1 = sub(q1, p1);
+    const Vector2 d2 = sub(q2, p2);
+    const Vector2 r = sub(p1, p2);
+    const float a = dot(d1, d1);
+    const float e = dot(d2, d2);
+    const float f = dot(d2, r);
+
+    float s = 0.0f;
+    float t = 0.0f;
+
+    if (a <= EPSILON && e <= EPSILON) {
+      *out_a = p1;
+      *out_b = p2;
+      return;
+    }
+
+    if (a <= EPSILON) {
+      t = std::clamp(f / e, 0.0f, 1.0f);
+    } else {
+      const float c = dot(d1, r);
+      if (e <= EPSILON) {
+        s = std::clamp(-c / a, 0.0f, 1.0f);
+      } else {
+        const float b = dot(d1, d2);
+        const float denom = a * e - b * b;
+        s = denom > EPSILON ? std::clamp((b * f - c * e) / denom, 0.0f, 1.0f) : 0.0f;
+        t = (b * s + f) / e;
+        if (t < 0.0f) {
+          t = 0.0f;
+          s = std::clamp(-c / a, 0.0f, 1.0f);
+        } else if (t > 1.0f) {
+          t = 1.0f;
+          s = std::clamp((b - c) / a, 0.0f, 1.0f);
+        }
+      }
+    }
+
+    *out_a = add(p1, scale(d1, s));
+    *out_b = add(p2, scale(d2, t));
+  }
+
+  bool sphere_contact(const Vector2 pos_a, const float radius_a, const Vector2 pos_b, const float radius_b,
+                      Narrowphase::Contact *out) {
+    const float dx = pos_b.x - pos_a.x;
+    const float dy = pos_b.y - pos_a.y;
+    const float distance_sq = dx * dx + dy * dy;
+
+    const float combined_radius = radius_a + radius_b;
+    if (distance_sq > combined_radius * combined_radius) {
+      return false;
+    }
+
+    if (out) {
+      const float distance = std::sqrt(distance_sq);
+      out->normal = distance > EPSILON ? Vector2{dx / distance, dy / distance} : Vector2{1.0f, 0.0f};
+      out->penetration = combined_radius - distance;
+      out->point = add(pos_a, scale(out->normal, radius_a));
+    }
+    return true;
+  }
+}
+
+namespace Narrowphase {
+  const std::array<Test, PAIR_COUNT> DISPATCH_TABLE = [] {
+    std::array<Test, PAIR_COUNT> table{};
+    using enum ColliderType;
+    table[pair_index(CIRCLE, CIRCLE)] = circle_vs_circle;
+    table[pair_index(CIRCLE, RECTANGLE)] = circle_vs_box;
+    table[pair_index(CIRCLE, ORIENTED_BOX)] = circle_vs_box;
+    table[pair_index(CIRCLE, CAPSULE)] = circle_vs_capsule;
+    table[pair_index(RECTANGLE, RECTANGLE)] = aabb_vs_aabb;
+    table[pair_index(RECTANGLE, ORIENTED_BOX)] = box_vs_box;
+    table[pair_index(RECTANGLE, CAPSULE)] = box_vs_capsule;
+    table[pair_index(ORIENTED_BOX, ORIENTED_BOX)] = box_vs_box;
+    table[pair_index(ORIENTED_BOX, CAPSULE)] = box_vs_capsule;
+    table[pair_index(CAPSULE, CAPSULE)] = capsule_vs_capsule;
+    return table;
+  }();
+
+  Shape make_shape(const Components::Transform &transform, const Components::Collider &collider) {
+    Shape shape;
+    shape.type = collider.type;
+    shape.center = transform.position;
+    shape.radius = collider.radius;
+    shape.half_extents = Vector2{collider.size.x / 2.0f, collider.size.y / 2.0f};
+    shape.half_length = collider.half_length;
+
+    if (collider.type == ColliderType::ORIENTED_BOX || collider.type == ColliderType::CAPSULE) {
+      const float angle = transform.rotation * DEG2RAD;
+      const float cos_a = std::cos(angle);
+      const float sin_a = std::sin(angle);
+      shape.axis_x = Vector2{cos_a, sin_a};
+      shape.axis_y = Vector2{-sin_a, cos_a};
+    }
+    return shape;
+  }
+
+  Rectangle get_bounds(const Shape &shape) {
+    float extent_x = shape.radius;
+    float extent_y = shape.radius;
+
+    switch (shape.type) {
+      case ColliderType::RECTANGLE:
+      case ColliderType::ORIENTED_BOX:
+        extent_x = shape.half_extents.x * std::abs(shape.axis_x.x) + shape.half_extents.y * std::abs(shape.axis_y.x);
+        extent_y = shape.half_extents.x * std::abs(shape.axis_x.y) + shape.half_extents.y * std::abs(shape.axis_y.y);
+        break;
+      case ColliderType::CAPSULE:
+        extent_x = shape.half_length * std::abs(shape.axis_x.x) + shape.radius;
+        extent_y = shape.half_length * std::abs(shape.axis_x.y) + shape.radius;
+        break;
+      default:
+        break;
+    }
+
+    return Rectangle{shape.center.x - extent_x, shape.center.y - extent_y, extent_x * 2.0f, extent_y * 2.0f};
+  }
+
+  bool circle_vs_circle(const Shape &a, const Shape &b, Contact *out) {
+    return sphere_contact(a.center, a.radius, b.center, b.radius, out);
+  }
+
+  bool circle_vs_box(const Shape &a, const Shape &b, Contact *out) {
+    const Vector2 local = to_local(b, a.center);
+    const Vector2 h = b.half_extents;
+    const Vector2 closest = {std::clamp(local.x, -h.x, h.x), std::clamp(local.y, -h.y, h.y)};
+
+    const bool inside = std::abs(local.x) < h.x && std::abs(local.y) < h.y;
+    Vector2 normal_local;
+    Vector2 point_local = closest;
+    float penetration;
+
+    if (!inside) {
+      const Vector2 d = sub(closest, local);
+      const float distance_sq = dot(d, d);
+      if (distance_sq > a.radius * a.radius) {
+        return false;
+      }
+      if (!out) {
+        return true;
+      }
+
+      const float distance = std::sqrt(distance_sq);
+      normal_local = distance > EPSILON ? scale(d, 1.0f / distance) : Vector2{0.0f, -1.0f};
+      penetration = a.radius - distance;
+    } else {
+      if (!out) {
+        return true;
+      }
+
+      // Центр кола всередині: виштовхуємо через найближчу грань
+      const float to_face_x = h.x - std::abs(local.x);
+      const float to_face_y = h.y - std::abs(local.y);
+      if (to_face_x < to_face_y) {
+        const float side = local.x > 0.0f ? 1.0f : -1.0f;
+        normal_local = Vector2{-side, 0.0f};
+        point_local = Vector2{side * h.x, local.y};
+        penetration = a.radius + to_face_x;
+      } else {
+        const float side = local.y > 0.0f ? 1.0f : -1.0f;
+        normal_local = Vector2{0.0f, -side};
+        point_local = Vector2{local.x, side * h.y};
+        penetration = a.radius + to_face_y;
+      }
+    }
+
+    out->normal = to_world_direction(b, normal_local);
+    out->point = add(b.center, to_world_direction(b, point_local));
+    out->penetration = penetration;
+    return true;
+  }
+
+  bool circle_vs_capsule(const Shape &a, const Shape &b, Contact *out) {
+    const Vector2 closest = closest_point_on_segment(segment_start(b), segment_end(b), a.center);
+    return sphere_contact(a.center, a.radius, closest, b.radius, out);
+  }
+
+  bool aabb_vs_aabb(const Shape &a, const Shape &b, Contact *out) {
+    const float dx = b.center.x - a.center.x;
+    const float dy = b.center.y - a.center.y;
+    const float overlap_x = a.half_extents.x + b.half_extents.x - std::abs(dx);
+    const float overlap_y = a.half_extents.y + b.half_extents.y - std::abs(dy);
+
+    if (overlap_x < 0.0f || overlap_y < 0.0f) {
+      return false;
+    }
+
+    if (out) {
+      if (overlap_x < overlap_y) {
+        out->normal = Vector2{dx < 0.0f ? -1.0f : 1.0f, 0.0f};
+        out->penetration = overlap_x;
+      } else {
+        out->normal = Vector2{0.0f, dy < 0.0f ? -1.0f : 1.0f};
+        out->penetration = overlap_y;
+      }
+
+      const float left = std::max(a.center.x - a.half_extents.x, b.center.x - b.half_extents.x);
+      const float right = std::min(a.center.x + a.half_extents.x, b.center.x + b.half_extents.x);
+      const float top = std::max(a.center.y - a.half_extents.y, b.center.y - b.half_extents.y);
+      const float bottom = std::min(a.center.y + a.half_extents.y, b.center.y + b.half_extents.y);
+      out->point = Vector2{(left + right) / 2.0f, (top + bottom) / 2.0f};
+    }
+    return true;
+  }
+
+  bool box_vs_box(const Shape &a, const Shape &b, Contact *out) {
+    // SAT: для двох прямокутників достатньо чотирьох осей — по дві від кожного
+    const Vector2 axes[4] = {a.axis_x, a.axis_y, b.axis_x, b.axis_y};
+    const Vector2 d = sub(b.center, a.center);
+
+    float min_overlap = INFINITY;
+    Vector2 best_axis = {1.0f, 0.0f};
+
+    for (const Vector2 &axis : axes) {
+      const float radius_a = a.half_extents.x * std::abs(dot(a.axis_x, axis)) +
+                             a.half_extents.y * std::abs(dot(a.axis_y, axis));
+      const float radius_b = b.half_extents.x * std::abs(dot(b.axis_x, axis)) +
+                             b.half_extents.y * std::abs(dot(b.axis_y, axis));
+      const float projection = dot(d, axis);
+      const float overlap = radius_a + radius_b - std::abs(projection);
+
+      if (overlap < 0.0f) {
+        return false;
+      }
+      if (overlap < min_overlap) {
+        min_overlap = overlap;
+        best_axis = projection < 0.0f ? scale(axis, -1.0f) : axis;
+      }
+    }
+
+    if (out) {
+      out->normal = best_axis;
+      out->penetration = min_overlap;
+
+      // Точка контакту — вершина B, що найглибше зайшла в A
+      const Vector2 ex = scale(b.axis_x, b.half_extents.x);
+      const Vector2 ey = scale(b.axis_y, b.half_extents.y);
+      const Vector2 corners[4] = {
+        add(b.center, add(ex, ey)), add(b.center, sub(ex, ey)),
+        sub(b.center, sub(ex, ey)), sub(b.center, add(ex, ey))
+      };
+      out->point = *std::ranges::min_element(corners, {}, [&best_axis](const Vector2 &corner) {
+        return dot(corner, best_axis);
+      });
+    }
+    return true;
+  }
+
+  bool box_vs_capsule(const Shape &a, const Shape &b, Contact *out) {
+    // SAT по різниці Мінковського: нормалі прямокутника, нормаль відрізка
+    // і напрямки від кутів прямокутника до кінців відрізка (заокруглені торці капсули)
+    const Vector2 start = segment_start(b);
+    const Vector2 end = segment_end(b);
+    const Vector2 ex = scale(a.axis_x, a.half_extents.x);
+    const Vector2 ey = scale(a.axis_y, a.half_extents.y);
+    const Vector2 corners[4] = {
+      add(a.center, add(ex, ey)), add(a.center, sub(ex, ey)),
+      sub(a.center, sub(ex, ey)), sub(a.center, add(ex, ey))
+    };
+
+    Vector2 axes[11] = {a.axis_x, a.axis_y, b.axis_y};
+    size_t axis_count = 3;
+    for (const Vector2 &corner : corners) {
+      for (const Vector2 &endpoint : {start, end}) {
+        const Vector2 d = sub(endpoint, corner);
+        if (const float length = std::sqrt(dot(d, d)); length > EPSILON) {
+          axes[axis_count++] = scale(d, 1.0f / length);
+        }
+      }
+    }
+
+    float min_overlap = INFINITY;
+    Vector2 best_normal = {1.0f, 0.0f};
+
+    for (size_t i = 0; i < axis_count; ++i) {
+      const Vector2 axis = axes[i];
+      const float center_a = dot(a.center, axis);
+      const float radius_a = a.half_extents.x * std::abs(dot(a.axis_x, axis)) +
+                             a.half_extents.y * std::abs(dot(a.axis_y, axis));
+      const float projection_start = dot(start, axis);
+      const float projection_end = dot(end, axis);
+      const float min_b = std::min(projection_start, projection_end) - b.radius;
+      const float max_b = std::max(projection_start, projection_end) + b.radius;
+
+      const float forward = center_a + radius_a - min_b;
+      const float backward = max_b - (center_a - radius_a);
+      if (forward < 0.0f || backward < 0.0f) {
+        return false;
+      }
+
+      const float overlap = std::min(forward, backward);
+      if (overlap < min_overlap) {
+        min_overlap = overlap;
+        best_normal = forward <= backward ? axis : scale(axis, -1.0f);
+      }
+    }
+
+    if (out) {
+      out->normal = best_normal;
+      out->penetration = min_overlap;
+      // Найглибша точка капсули в напрямку A
+      const Vector2 deepest = dot(start, best_normal) <= dot(end, best_normal) ? start : end;
+      out->point = sub(deepest, scale(best_normal, b.radius));
+    }
+    return true;
+  }
+
+  bool capsule_vs_capsule(const Shape &a, const Shape &b, Contact *out) {
+    Vector2 closest_a;
+    Vector2 closest_b;
+    closest_points_between_segments(segment_start(a), segment_end(a), segment_start(b), segment_end(b),
+                                    &closest_a, &closest_b);
+    if (!sphere_contact(closest_a, a.radius, closest_b, b.radius, out)) {
+      return false;
+    }
+
+    if (!out) {
+      return true;
+    }
+
+    const Vector2 d = sub(closest_b, closest_a);
+    if (dot(d, d) > EPSILON) {
+      return true;
+    }
+
+    // Відрізки перетинаються: напрямок між найближчими точками вироджений,
+    // тому шукаємо найменше перекриття вздовж нормалей обох відрізків
+    const Vector2 points_a[2] = {segment_start(a), segment_end(a)};
+    const Vector2 points_b[2] = {segment_start(b), segment_end(b)};
+    out->penetration = INFINITY;
+    for (const Vector2 &axis : {a.axis_y, b.axis_y}) {
+      const float a0 = dot(points_a[0], axis);
+      const float a1 = dot(points_a[1], axis);
+      const float b0 = dot(points_b[0], axis);
+      const float b1 = dot(points_b[1], axis);
+      const float forward = std::max(a0, a1) + a.radius - (std::min(b0, b1) - b.radius);
+      const float backward = std::max(b0, b1) + b.radius - (std::min(a0, a1) - a.radius);
+
+      if (const float overlap = std::min(forward, backward); overlap < out->penetration) {
+        out->penetration = overlap;
+        out->normal = forward <= backward ? axis : scale(axis, -1.0f);
+      }
+    }
+    return true;
+  }
+
+  void debug_draw(const Shape &shape, const Color color) {
+    RenderBackend &backend = RenderBackend::get();
+
+    switch (shape.type) {
+      case ColliderType::CIRCLE:
+        backend.draw_circle_lines(shape.center, shape.radius, color);
+        break;
+      case ColliderType::RECTANGLE:
+      case ColliderType::ORIENTED_BOX: {
+        const Vector2 ex = scale(shape.axis_x, shape.half_extents.x);
+        const Vector2 ey = scale(shape.axis_y, shape.half_extents.y);
+        const Vector2 corners[4] = {
+          sub(shape.center, add(ex, ey)), add(shape.center, sub(ex, ey)),
+          add(shape.center, add(ex, ey)), sub(shape.center, sub(ex, ey))
+        };
+        for (int i = 0; i < 4; ++i) {
+          backend.draw_line(corners[i], corners[(i + 1) % 4], color);
+        }
+        break;
+      }
+      case ColliderType::CAPSULE: {
+        const Vector2 start = segment_start(shape);
+        const Vector2 end = segment_end(shape);
+        const Vector2 side = scale(shape.axis_y, shape.radius);
+        backend.draw_circle_lines(start, shape.radius, color);
+        backend.draw_circle_lines(end, shape.radius, color);
+        backend.draw_line(add(start, side), add(end, side), color);
+        backend.draw_line(sub(start, side), sub(end, side), color);
+        break;
+      }
+      default:
+        break;
+    }
+  }
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <array>
+
+#include "raylib.h"
+#include "components/Collider.h"
+#include "components/Transform.h"
+
+namespace Narrowphase {
+  // Форма колайдера, підготовлена один раз на кадр: позиція, осі повороту і розміри
+  struct Shape {
+    Components::ColliderType type = Components::ColliderType::CIRCLE;
+    Vector2 center = {0.0f, 0.0f};
+    Vector2 axis_x = {1.0f, 0.0f};
+    Vector2 axis_y = {0.0f, 1.0f};
+    Vector2 half_extents = {0.0f, 0.0f};
+    float radius = 0.0f;
+    float half_length = 0.0f;
+  };
+
+  struct Contact {
+    Vector2 point;
+    Vector2 normal;       // від A до B
+    float penetration;
+  };
+
+  using Test = bool (*)(const Shape &a, const Shape &b, Contact *out);
+
+  constexpr size_t SHAPE_COUNT = static_cast<size_t>(Components::ColliderType::COUNT);
+  constexpr size_t PAIR_COUNT = SHAPE_COUNT * SHAPE_COUNT;
+
+  constexpr size_t pair_index(Components::ColliderType a, Components::ColliderType b) {
+    return static_cast<size_t>(a) * SHAPE_COUNT + static_cast<size_t>(b);
+  }
+
+  // Заповнена лише для type(a) <= type(b); для інших пар аргументи міняються місцями
+  extern const std::array<Test, PAIR_COUNT> DISPATCH_TABLE;
+
+  Shape make_shape(const Components::Transform &transform, const Components::Collider &collider);
+  Rectangle get_bounds(const Shape &shape);
+
+  bool circle_vs_circle(const Shape &a, const Shape &b, Contact *out);
+  bool circle_vs_box(const Shape &a, const Shape &b, Contact *out);
+  bool circle_vs_capsule(const Shape &a, const Shape &b, Contact *out);
+  bool aabb_vs_aabb(const Shape &a, const Shape &b, Contact *out);
+  bool box_vs_box(const Shape &a, const Shape &b, Contact *out);
+  bool box_vs_capsule(const Shape &a, const Shape &b, Contact *out);
+  bool capsule_vs_capsule(const Shape &a, const Shape &b, Contact *out);
+
+  void debug_draw(const Shape &shape, Color color);
+}
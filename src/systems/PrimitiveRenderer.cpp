@@ -0,0 +1,152 @@
+#include "PrimitiveRenderer.h"
+
+#include <algorithm>
+#include <string>
+
+#include "rlgl.h"
+#include "utils.h"
+#include "render/RenderBackend.h"
+
+namespace {
+
+// Текстурні координати квада — від -1 до 1 відносно центру кола; прямокутники мають (0, 0) і залиті повністю
+constexpr const char *SDF_FRAGMENT_330 = R"(#version 330
+in vec2 fragTexCoord;
+in vec4 fragColor;
+out vec4 finalColor;
+
+void main() {
+    float dist = length(fragTexCoord);
+    float edge = max(fwidth(dist), 0.0001);
+    float alpha = 1.0 - smoothstep(1.0 - edge, 1.0, dist);
+    if (alpha <= 0.0) discard;
+    finalColor = vec4(fragColor.rgb, fragColor.a*alpha);
+}
+)";
+
+constexpr const char *SDF_FRAGMENT_LEGACY_BODY = R"(
+varying vec2 fragTexCoord;
+varying vec4 fragColor;
+
+void main() {
+    float dist = length(fragTexCoord);
+    float edge = max(fwidth(dist), 0.0001);
+    float alpha = 1.0 - smoothstep(1.0 - edge, 1.0, dist);
+    if (alpha <= 0.0) discard;
+    gl_FragColor = vec4(fragColor.rgb, fragColor.a*alpha);
+}
+)";
+
+std::string get_fragment_source() {
+  switch (rlGetVersion()) {
+    case RL_OPENGL_33:
+    case RL_OPENGL_43:
+      return SDF_FRAGMENT_330;
+    case RL_OPENGL_21:
+      return std::string("#version 120\n") + SDF_FRAGMENT_LEGACY_BODY;
+    case RL_OPENGL_ES_20:
+    case RL_OPENGL_ES_30:
+      return std::string("#version 100\n#extension GL_OES_standard_derivatives : enable\nprecision mediump float;\n") +
+             SDF_FRAGMENT_LEGACY_BODY;
+    default:
+      return {};
+  }
+}
+
+} // namespace
+
+PrimitiveRenderer::~PrimitiveRenderer() {
+  unload();
+}
+
+void PrimitiveRenderer::add_circle(const Vector2 center, const float radius, const Color color, const int layer) {
+  primitives_.push_back({
+    Rectangle{center.x - radius, center.y - radius, radius * 2.f, radius * 2.f},
+    color,
+    layer,
+    true
+  });
+}
+
+void PrimitiveRenderer::add_rect(const Rectangle rect, const Color color, const int layer) {
+  primitives_.push_back({rect, color, layer, false});
+}
+
+void PrimitiveRenderer::flush() {
+  last_primitive_count_ = primitives_.size();
+  last_batch_count_ = 0;
+
+  if (primitives_.empty()) {
+    return;
+  }
+
+  if (!shader_loaded_) {
+    load_shader();
+  }
+
+  // Зазвичай примітиви вже приходять упорядкованими — тоді сортування не потрібне
+  if (!std::ranges::is_sorted(primitives_, {}, &Primitive::layer)) {
+    std::ranges::stable_sort(primitives_, {}, &Primitive::layer);
+  }
+
+  if (sdf_available_) {
+    submit_sdf();
+  } else {
+    submit_fallback();
+  }
+
+  primitives_.clear();
+}
+
+void PrimitiveRenderer::unload() {
+  if (sdf_available_) {
+    RenderBackend::get().unload_shader(shader_);
+  }
+  shader_ = {0, nullptr};
+  shader_loaded_ = false;
+  sdf_available_ = false;
+}
+
+void PrimitiveRenderer::load_shader() {
+  shader_loaded_ = true;
+
+  const std::string source = get_fragment_source();
+  if (source.empty()) {
+    TRACELOG(LOG_WARNING, "PrimitiveRenderer: shaders unsupported, using DrawCircleV fallback");
+    return;
+  }
+
+  shader_ = RenderBackend::get().load_shader(source.c_str());
+  sdf_available_ = shader_.id != 0;
+
+  if (!sdf_available_) {
+    TRACELOG(LOG_WARNING, "PrimitiveRenderer: SDF shader failed to compile, using DrawCircleV fallback");
+  }
+}
+
+void PrimitiveRenderer::submit_sdf() {
+  RenderBackend &backend = RenderBackend::get();
+  backend.begin_quads(shader_);
+  const size_t flushes_before = backend.get_report().batch_flushes;
+
+  for (const Primitive &primitive : primitives_) {
+    backend.draw_quad(primitive.quad, primitive.circle ? 1.f : 0.f, primitive.color);
+  }
+  backend.end_quads();
+
+  // Пакет закривається скиданням у end_quads(); переповнення буфера посеред нього додають ще
+  last_batch_count_ = backend.get_report().batch_flushes - flushes_before;
+}
+
+void PrimitiveRenderer::submit_fallback() const {
+  RenderBackend &backend = RenderBackend::get();
+
+  for (const Primitive &primitive : primitives_) {
+    if (primitive.circle) {
+      const float radius = primitive.quad.width * 0.5f;
+      backend.draw_circle({primitive.quad.x + radius, primitive.quad.y + radius}, radius, primitive.color);
+    } else {
+      backend.draw_rect(primitive.quad, primitive.color);
+    }
+  }
+}
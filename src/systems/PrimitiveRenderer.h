@@ -0,0 +1,47 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+#include "raylib.h"
+
+// Збирає кола й прямокутники кадру і малює кожен одним квадом через SDF-шейдер.
+// Усі примітиви йдуть одним пакетом rlgl; без шейдерів — фолбек на DrawCircleV/DrawRectangleRec
+class PrimitiveRenderer {
+private:
+  struct Primitive {
+    Rectangle quad;
+    Color color;
+    int layer;
+    bool circle;
+  };
+
+  std::vector<Primitive> primitives_;
+  Shader shader_ = {0, nullptr};
+  bool shader_loaded_ = false;
+  bool sdf_available_ = false;
+  size_t last_batch_count_ = 0;
+  size_t last_primitive_count_ = 0;
+
+public:
+  PrimitiveRenderer() = default;
+  ~PrimitiveRenderer();
+
+  PrimitiveRenderer(const PrimitiveRenderer&) = delete;
+  PrimitiveRenderer& operator=(const PrimitiveRenderer&) = delete;
+
+  void add_circle(Vector2 center, float radius, Color color, int layer = 0);
+  void add_rect(Rectangle rect, Color color, int layer = 0);
+
+  // Сортує за шаром (стабільно) і відправляє все накопичене
+  void flush();
+  void unload();
+
+  bool is_sdf_available() const { return sdf_available_; }
+  size_t get_last_batch_count() const { return last_batch_count_; }
+  size_t get_last_primitive_count() const { return last_primitive_count_; }
+
+private:
+  void load_shader();
+  void submit_sdf();
+  void submit_fallback() const;
+};
@@ -0,0 +1,176 @@
+#include "RenderCommandBuffer.h"
+
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+
+#include "PrimitiveRenderer.h"
+#include "core/RadixSort.h"
+
+void RenderCommandBuffer::clear() {
+  commands_.clear();
+  layers_.clear();
+  text_.clear();
+  textures_.clear();
+  glyphs_.clear();
+  space_ = RenderSpace::WORLD;
+  has_world_ = false;
+  world_count_ = 0;
+}
+
+void RenderCommandBuffer::push(const RenderCommand &command, const int layer) {
+  commands_.push_back(command);
+  layers_.push_back(layer);
+}
+
+void RenderCommandBuffer::add_circle(const Vector2 center, const float radius, const Color color, const int layer) {
+  push({Rectangle{center.x, center.y, radius, 0}, color, RenderCommandType::CIRCLE, space_, false, 0, 0}, layer);
+}
+
+void RenderCommandBuffer::add_rect(const Rectangle rect, const Color color, const int layer) {
+  push({rect, color, RenderCommandType::RECT, space_, false, 0, 0}, layer);
+}
+
+void RenderCommandBuffer::add_rect_lines(const Rectangle rect, const Color color, const int layer) {
+  push({rect, color, RenderCommandType::RECT_LINES, space_, false, 0, 0}, layer);
+}
+
+void RenderCommandBuffer::add_text(const std::string_view text, const float x, const float y, const int font_size,
+                                   const Color color, const int layer) {
+  // Рядки лежать в одному буфері, розділені нулями — DrawText отримує готовий C-рядок
+  const auto offset = static_cast<std::uint32_t>(text_.size());
+  text_.append(text);
+  text_.push_back('\0');
+  push({Rectangle{x, y, static_cast<float>(font_size), 0}, color, RenderCommandType::TEXT, space_, false, offset,
+        static_cast<std::uint32_t>(text.size())}, layer);
+}
+
+void RenderCommandBuffer::add_textf(const float x, const float y, const int font_size, const Color color,
+                                    const char *format, ...) {
+  char buffer[256];
+
+  va_list args;
+  va_start(args, format);
+  const int length = std::vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+
+  if (length < 0) {
+    return;
+  }
+  add_text(std::string_view(buffer, std::min(static_cast<size_t>(length), sizeof(buffer) - 1)), x, y, font_size, color);
+}
+
+void RenderCommandBuffer::add_text_centered(const std::string_view text, const float center_x, const float y,
+                                            const int font_size, const Color color, const int layer) {
+  add_text(text, center_x, y, font_size, color, layer);
+  commands_.back().centered = true;
+}
+
+void RenderCommandBuffer::add_texture(const Texture2D &texture, const Rectangle source, const Rectangle dest,
+                                      const Color tint, const int layer) {
+  const auto index = static_cast<std::uint32_t>(textures_.size());
+  textures_.push_back({texture, source});
+  push({dest, tint, RenderCommandType::TEXTURE, space_, false, index, 0}, layer);
+}
+
+void RenderCommandBuffer::add_glyphs(const GlyphQuad *quads, const size_t count, const int layer) {
+  if (count == 0) {
+    return;
+  }
+  const auto offset = static_cast<std::uint32_t>(glyphs_.size());
+  glyphs_.insert(glyphs_.end(), quads, quads + count);
+  push({Rectangle{0, 0, 0, 0}, WHITE, RenderCommandType::GLYPHS, space_, false, offset,
+        static_cast<std::uint32_t>(count)}, layer);
+}
+
+void RenderCommandBuffer::sort() {
+  // Ключ: [63] простір, [62..32] зміщений шар, [31..0] порядок запису — сортування стабільне
+  const auto count = static_cast<std::uint32_t>(commands_.size());
+  keys_.resize(count);
+  order_.resize(count);
+  world_count_ = 0;
+
+  for (std::uint32_t i = 0; i < count; ++i) {
+    const auto space_bit = static_cast<std::uint64_t>(commands_[i].space == RenderSpace::SCREEN);
+    const auto biased_layer = static_cast<std::uint64_t>(std::clamp(layers_[i], -32768, 32767) + 32768);
+    keys_[i] = space_bit << 63 | biased_layer << 32 | i;
+    order_[i] = i;
+    world_count_ += space_bit == 0;
+  }
+
+  radix_sort(keys_, order_, scratch_keys_, scratch_order_);
+
+  sorted_commands_.resize(count);
+  for (std::uint32_t i = 0; i < count; ++i) {
+    sorted_commands_[i] = commands_[order_[i]];
+  }
+  commands_.swap(sorted_commands_);
+}
+
+void RenderCommandBuffer::execute(const RenderSpace space, PrimitiveRenderer &renderer) const {
+  const auto begin = space == RenderSpace::WORLD ? commands_.begin() : commands_.begin() + static_cast<std::ptrdiff_t>(world_count_);
+  const auto end = space == RenderSpace::WORLD ? commands_.begin() + static_cast<std::ptrdiff_t>(world_count_) : commands_.end();
+
+  RenderBackend &backend = RenderBackend::get();
+  glyph_batch_.clear();
+
+  for (auto it = begin; it != end; ++it) {
+    const RenderCommand &command = *it;
+
+    if (command.type == RenderCommandType::GLYPHS) {
+      renderer.flush();
+      glyph_batch_.insert(glyph_batch_.end(), glyphs_.begin() + command.payload,
+                          glyphs_.begin() + command.payload + command.payload_size);
+      continue;
+    }
+    flush_glyphs(backend);
+
+    switch (command.type) {
+      case RenderCommandType::CIRCLE:
+        renderer.add_circle({command.rect.x, command.rect.y}, command.rect.width, command.color);
+        break;
+
+      case RenderCommandType::RECT:
+        renderer.add_rect(command.rect, command.color);
+        break;
+
+      case RenderCommandType::RECT_LINES:
+        renderer.flush();
+        backend.draw_rect_lines(command.rect, command.color);
+        break;
+
+      case RenderCommandType::TEXT: {
+        renderer.flush();
+        const char *text = text_.data() + command.payload;
+        const auto font_size = static_cast<int>(command.rect.width);
+        int x = static_cast<int>(command.rect.x);
+        if (command.centered) {
+          x -= backend.measure_text(text, font_size) / 2;
+        }
+        backend.draw_text(text, x, static_cast<int>(command.rect.y), font_size, command.color);
+        break;
+      }
+
+      case RenderCommandType::TEXTURE: {
+        renderer.flush();
+        const TextureDraw &draw = textures_[command.payload];
+        backend.draw_texture(draw.texture, draw.source, command.rect, {0, 0}, 0.f, command.color);
+        break;
+      }
+
+      default:
+        break;
+    }
+  }
+
+  flush_glyphs(backend);
+  renderer.flush();
+}
+
+void RenderCommandBuffer::flush_glyphs(RenderBackend &backend) const {
+  if (glyph_batch_.empty()) {
+    return;
+  }
+  backend.draw_glyphs(glyph_batch_.data(), glyph_batch_.size());
+  glyph_batch_.clear();
+}
@@ -0,0 +1,99 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "raylib.h"
+#include "render/RenderBackend.h"
+
+class PrimitiveRenderer;
+
+enum class RenderSpace : std::uint8_t {
+  WORLD,   // під камерою кадру
+  SCREEN   // поверх, у координатах екрана
+};
+
+enum class RenderCommandType : std::uint8_t {
+  CIRCLE,
+  RECT,
+  RECT_LINES,
+  TEXT,
+  TEXTURE,
+  GLYPHS
+};
+
+// Компактна команда: rect трактується за типом
+// (коло — центр і радіус у x/y/width, текст — позиція і розмір шрифту, текстура — прямокутник призначення)
+struct RenderCommand {
+  Rectangle rect;
+  Color color;
+  RenderCommandType type;
+  RenderSpace space;
+  bool centered;
+  std::uint32_t payload;   // зсув тексту в text_ чи гліфів у glyphs_, або індекс у textures_
+  std::uint32_t payload_size;
+};
+
+// Список команд кадру, який записує симуляція і виконує рендер-потік.
+// Записуються лише дані — жодних викликів raylib до execute()
+class RenderCommandBuffer {
+private:
+  struct TextureDraw {
+    Texture2D texture;
+    Rectangle source;
+  };
+
+  std::vector<RenderCommand> commands_;
+  std::vector<RenderCommand> sorted_commands_;
+  std::vector<std::uint64_t> keys_;
+  std::vector<std::uint32_t> order_;
+  std::vector<std::uint64_t> scratch_keys_;
+  std::vector<std::uint32_t> scratch_order_;
+  std::vector<int> layers_;
+  std::string text_;
+  std::vector<TextureDraw> textures_;
+  std::vector<GlyphQuad> glyphs_;
+  // Сусідні GLYPHS-команди після сортування зливаються сюди і йдуть одним викликом
+  mutable std::vector<GlyphQuad> glyph_batch_;
+
+  RenderSpace space_ = RenderSpace::WORLD;
+  Camera2D camera_ = {{0, 0}, {0, 0}, 0.f, 1.f};
+  Color clear_color_ = BLACK;
+  bool has_world_ = false;
+  size_t world_count_ = 0;
+
+public:
+  void clear();
+
+  void set_space(RenderSpace space) { space_ = space; }
+  void set_camera(const Camera2D &camera) { camera_ = camera; has_world_ = true; }
+  void set_clear_color(Color color) { clear_color_ = color; }
+
+  const Camera2D& get_camera() const { return camera_; }
+  Color get_clear_color() const { return clear_color_; }
+  bool has_world() const { return has_world_; }
+  size_t get_command_count() const { return commands_.size(); }
+
+  void add_circle(Vector2 center, float radius, Color color, int layer = 0);
+  void add_rect(Rectangle rect, Color color, int layer = 0);
+  void add_rect_lines(Rectangle rect, Color color, int layer = 0);
+  void add_text(std::string_view text, float x, float y, int font_size, Color color, int layer = 0);
+  // printf-формат без TextFormat: той повертає статичний буфер raylib, небезпечний поза потоком рендера
+  void add_textf(float x, float y, int font_size, Color color, const char *format, ...);
+  void add_text_centered(std::string_view text, float center_x, float y, int font_size, Color color, int layer = 0);
+  void add_texture(const Texture2D &texture, Rectangle source, Rectangle dest, Color tint, int layer = 0);
+  // Копіює вже розкладені гліфи (див. HudText) — розкладка не повторюється на потоці рендера
+  void add_glyphs(const GlyphQuad *quads, size_t count, int layer = 0);
+
+  // Стабільно сортує за (простір, шар); викликається симуляцією в кінці запису
+  void sort();
+
+  // Тільки з потоку рендера: кола й прямокутники йдуть пакетом через renderer, решта — напряму
+  void execute(RenderSpace space, PrimitiveRenderer &renderer) const;
+
+private:
+  void push(const RenderCommand &command, int layer);
+  void flush_glyphs(RenderBackend &backend) const;
+};
@@ -5,13 +5,28 @@
 #include "RenderSystem.h"
 
 #include <algorithm>
+#include <bit>
+#include <cmath>
 #include <iostream>
 #include <ranges>
 
 #include "utils.h"
+#include "core/RadixSort.h"
+#include "render/RenderBackend.h"
+
+RenderSystem::RenderSystem() {
+  images_.push_back(GenImageChecked(16, 16, 8, 8, MAGENTA, BLACK));
+  atlas_dirty_ = true;
+}
 
 RenderSystem::~RenderSystem() {
+  for (const StaticLayer &static_layer : static_layers_ | std::views::values) {
+    if (static_layer.target.id != 0) {
+      RenderBackend::get().unload_render_texture(static_layer.target);
+    }
+  }
   unload_all_textures();
+  UnloadImage(images_[TextureRegistry::PLACEHOLDER]);
 }
 
 void RenderSystem::register_entity(Entity *entity) {
@@ -20,106 +35,192 @@ void RenderSystem::register_entity(Entity *entity) {
     return;
   }
 
-  if (const auto it = std::ranges::find(entities_, entity); it != entities_.end()) {
+  if (const auto it = std::ranges::find(renderables_, entity, &Renderable::entity); it != renderables_.end()) {
     TRACELOG(LOG_WARNING, "Entity %d already registered in RenderSystem!", entity->get_id());
     return;
   }
 
-  entities_.push_back(entity);
+  renderables_.push_back({
+    entity,
+    entity->get_component<Components::Transform>(),
+    entity->get_component<Components::Sprite>(),
+    0,
+    0,
+    0.f
+  });
+  order_dirty_ = true;
   TRACELOG(LOG_INFO, "Entity %d registered in RenderSystem!", entity->get_id());
 }
 
 void RenderSystem::unregister_entity(const Entity *entity) {
-  if (const auto it = std::ranges::find(entities_, entity); it != entities_.end()) {
-    entities_.erase(it);
+  if (const auto it = std::ranges::find(renderables_, entity, &Renderable::entity); it != renderables_.end()) {
+    renderables_.erase(it);
+    order_dirty_ = true;
     TRACELOG(LOG_INFO, "Entity %d unregistered from RenderSystem!", entity->get_id());
   }
 }
 
-void RenderSystem::load_texture(const std::string &name, const std::string &path) {
-  if (textures_.contains(name)) {
+TextureHandle RenderSystem::load_texture(const std::string &name, const std::string &path) {
+  const TextureHandle handle = TextureRegistry::intern(name);
+  if (handle == TextureRegistry::PLACEHOLDER) {
+    return handle;
+  }
+
+  if (handle < images_.size() && images_[handle].data != nullptr) {
     TRACELOG(LOG_WARNING, "Texture %s already loaded!", name.c_str());
-    return;
+    return handle;
   }
 
-  const Texture2D texture = LoadTexture(path.c_str());
+  const Image image = LoadImage(path.c_str());
 
-  if (texture.id == 0) {
+  if (image.data == nullptr) {
     TRACELOG(LOG_ERROR, "Failed to load texture %s", path.c_str());
-    return;
+    return handle;
+  }
+
+  add_image(handle, image);
+  TRACELOG(LOG_INFO, "Loaded texture %s (%d x %d), ", name.c_str(), image.width, image.height);
+  return handle;
+}
+
+bool RenderSystem::add_image(const TextureHandle handle, const Image &image) {
+  if (handle == TextureRegistry::PLACEHOLDER || image.data == nullptr ||
+      (handle < images_.size() && images_[handle].data != nullptr)) {
+    return false;
+  }
+
+  if (handle >= images_.size()) {
+    images_.resize(handle + 1, Image{nullptr, 0, 0, 0, 0});
   }
+  images_[handle] = image;
 
-  textures_[name] = texture;
-  TRACELOG(LOG_INFO, "Loaded texture %s (%s x %s), ", name.c_str(), texture.width, texture.height);
+  // Атлас уже зібрано — дописуємо одне зображення замість повного перепакування
+  if (!atlas_dirty_) {
+    regions_.resize(images_.size());
+    regions_[handle] = atlas_.insert(image);
+  }
+  return true;
 }
 
 void RenderSystem::unload_all_textures() {
-  for (const auto &texture: textures_ | std::views::values) {
-    UnloadTexture(texture);
-    TRACELOG(LOG_INFO, "Unloaded texture %s", texture.name.c_str());
+  // Заглушка лишається до деструктора — спрайти мають куди впасти
+  for (size_t handle = TextureRegistry::PLACEHOLDER + 1; handle < images_.size(); ++handle) {
+    if (images_[handle].data != nullptr) {
+      UnloadImage(images_[handle]);
+    }
+  }
+  atlas_.unload();
+  images_.resize(TextureRegistry::PLACEHOLDER + 1);
+  regions_.clear();
+  atlas_dirty_ = true;
+  TRACELOG(LOG_INFO, "Unloaded all textures");
+}
+
+void RenderSystem::set_atlas_enabled(const bool enabled) {
+  if (atlas_enabled_ != enabled) {
+    atlas_enabled_ = enabled;
+    atlas_dirty_ = true;
   }
-  textures_.clear();
+}
+
+void RenderSystem::rebuild_atlas() {
+  atlas_.build(images_, regions_, !atlas_enabled_);
+  atlas_dirty_ = false;
 }
 
 void RenderSystem::render() {
-  sort_entities_by_layer();
+  // Пакуємо тут, а не в load_texture, щоб серія завантажень давала одну перебудову
+  if (atlas_dirty_) {
+    rebuild_atlas();
+  }
+
+  update_draw_order();
+  update_static_layers();
 
+  RenderBackend &backend = RenderBackend::get();
   if (camera_) {
-    BeginMode2D(*camera_);
+    backend.begin_mode_2d(*camera_);
   }
 
-  for (const Entity *entity: entities_) {
-    if (is_valid_entity(entity)) {
-      render_entity(entity);
+  const Rectangle view = get_view_bounds();
+  if (culling_enabled_) {
+    collect_visible(view);
+  } else {
+    visible_ = draw_order_;
+  }
+
+  stats_.draw_calls = 0;
+  stats_.batch_flushes = 0;
+  bound_batch_ = UINT32_MAX;
+
+  // Статичні шари вплітаються в порядок спрайтів за індексом шару
+  auto next_static = static_layers_.begin();
+  for (const std::uint32_t index : visible_) {
+    const Renderable &renderable = renderables_[index];
+    for (; next_static != static_layers_.end() && next_static->first <= renderable.sprite->layer; ++next_static) {
+      bind_batch(STATIC_LAYER_BATCH + static_cast<std::uint32_t>(next_static->first + 32768));
+      draw_static_layer(next_static->second, view);
     }
+    render_renderable(renderable);
+  }
+  for (; next_static != static_layers_.end(); ++next_static) {
+    bind_batch(STATIC_LAYER_BATCH + static_cast<std::uint32_t>(next_static->first + 32768));
+    draw_static_layer(next_static->second, view);
   }
+  primitive_renderer_.flush();
+
+  stats_.visible = visible_.size();
+  stats_.culled = renderables_.size() - visible_.size();
 
   if (camera_) {
-    EndMode2D();
+    backend.end_mode_2d();
   }
 }
 
-void RenderSystem::render_entity(const Entity *entity) {
-  Components::Transform *transform = entity->get_component<Components::Transform>();
-  Components::Sprite *sprite = entity->get_component<Components::Sprite>();
+void RenderSystem::bind_batch(const std::uint32_t batch_id) {
+  if (bound_batch_ != batch_id) {
+    if (bound_batch_ != UINT32_MAX) {
+      ++stats_.batch_flushes;
+    }
+    if (bound_batch_ == 0) {
+      primitive_renderer_.flush();
+    }
+    bound_batch_ = batch_id;
+  }
+  ++stats_.draw_calls;
+}
 
-  if (!sprite->visible) {
+void RenderSystem::render_renderable(const Renderable &renderable) {
+  if (!renderable.sprite->visible) {
     return;
   }
 
-  if (sprite->use_primitive) {
-    render_primitive(transform, sprite);
+  if (renderable.sprite->use_primitive) {
+    render_primitive(renderable.transform, renderable.sprite);
   } else {
-    render_sprite_texture(transform, sprite);
+    render_sprite_texture(renderable);
   }
 }
 
 void RenderSystem::render_primitive(const Components::Transform *transform, const Components::Sprite *sprite) {
   const float radius = sprite->primitive_radius * transform->scale.x;
 
-  DrawCircleV(transform->position, radius, sprite->primitive_color);
-
-#ifdef _DEBUG
-  DrawCircleLines(
-    static_cast<int>(transform->position.x),
-    static_cast<int>(transform->position.y),
-    radius,
-    RED);
-#endif
+  bind_batch(0);
+  primitive_renderer_.add_circle(transform->position, radius, sprite->primitive_color, sprite->layer);
 }
 
-void RenderSystem::render_sprite_texture(const Components::Transform *transform, const Components::Sprite *sprite) {
-  const auto it = textures_.find(sprite->texture_name);
-  if (it == textures_.end()) {
-    TRACELOG(LOG_WARNING, "Failed to find texture %s. Fallback to PRIMITIVE rendering", sprite->texture_name.c_str());
-    render_primitive(transform, sprite);
-  }
+void RenderSystem::render_sprite_texture(const Renderable &renderable) {
+  const Components::Transform *transform = renderable.transform;
+  const Components::Sprite *sprite = renderable.sprite;
+  const AtlasRegion &region = get_region(sprite->texture);
 
-  const Texture2D &texture = it->second;
+  // source_rect спрайта задано відносно його текстури — переносимо в координати сторінки
   Rectangle source = sprite->source_rect;
   if (source.width == 0 || source.height == 0) {
-    source = Rectangle{0, 0, static_cast<float>(texture.width), static_cast<float>(texture.height)};
+    source = Rectangle{0, 0, region.rect.width, region.rect.height};
   }
+  source.x += region.rect.x;
+  source.y += region.rect.y;
 
   const Rectangle dest = {
     transform->position.x,
@@ -133,23 +234,268 @@ void RenderSystem::render_sprite_texture(const Components::Transform *transform,
     source.height * sprite->origin.y
   };
 
-  DrawTexturePro(texture, source, dest, origin, transform->rotation, sprite->tint);
+  bind_batch(region.page + 1u);
+  RenderBackend::get().draw_texture(atlas_.get_page(region.page), source, dest, origin, transform->rotation, sprite->tint);
+}
+
+
+std::uint64_t RenderSystem::make_sort_key(const int layer, const std::uint16_t batch_id, const float y_depth) {
+  // Знаковий шар зміщуємо, а float перетворюємо так, щоб беззнакове порівняння зберігало порядок
+  const auto biased_layer = static_cast<std::uint16_t>(std::clamp(layer, -32768, 32767) + 32768);
+  const auto depth_bits = std::bit_cast<std::uint32_t>(y_depth);
+  const std::uint32_t sortable_depth = depth_bits & 0x80000000u ? ~depth_bits : depth_bits | 0x80000000u;
+
+  return static_cast<std::uint64_t>(biased_layer) << 48 |
+         static_cast<std::uint64_t>(batch_id) << 32 |
+         sortable_depth;
+}
+
+const AtlasRegion &RenderSystem::get_region(const TextureHandle handle) const {
+  // Незавантажений хендл малюється заглушкою, без логування щокадру
+  if (handle < images_.size() && images_[handle].data != nullptr) {
+    return regions_[handle];
+  }
+  return regions_[TextureRegistry::PLACEHOLDER];
+}
+
+std::uint16_t RenderSystem::get_batch_id(const Renderable &renderable) const {
+  if (renderable.sprite->use_primitive) {
+    return 0;
+  }
+  return static_cast<std::uint16_t>(get_region(renderable.sprite->texture).page + 1);
+}
+
+float RenderSystem::compute_extent(const Renderable &renderable) const {
+  const Components::Transform *transform = renderable.transform;
+  const Components::Sprite *sprite = renderable.sprite;
+  const float scale = std::max(std::abs(transform->scale.x), std::abs(transform->scale.y));
+
+  if (sprite->use_primitive) {
+    return sprite->primitive_radius * scale;
+  }
+
+  Vector2 size = {sprite->source_rect.width, sprite->source_rect.height};
+  if (size.x == 0 || size.y == 0) {
+    const Rectangle &rect = get_region(sprite->texture).rect;
+    size = {rect.width, rect.height};
+  }
+  // Діагональ покриває будь-яку точку опори всередині прямокутника і будь-який поворот
+  return std::hypot(size.x, size.y) * scale;
+}
+
+void RenderSystem::update_draw_order() {
+  const bool set_changed = order_dirty_;
+  bool keys_changed = order_dirty_;
+  max_extent_ = 0.f;
+
+  for (std::uint32_t i = 0; i < renderables_.size(); ++i) {
+    Renderable &renderable = renderables_[i];
+    const std::uint64_t key = make_sort_key(
+      renderable.sprite->layer,
+      get_batch_id(renderable),
+      renderable.transform->position.y);
+
+    if (key != renderable.sort_key) {
+      renderable.sort_key = key;
+      keys_changed = true;
+    }
+
+    renderable.extent = compute_extent(renderable);
+    max_extent_ = std::max(max_extent_, renderable.extent);
+
+    // Сітку оновлюємо лише тоді, коли сутність перейшла в іншу клітинку
+    const SpatialGrid::CellKey cell = cull_grid_.cell_of(renderable.transform->position);
+    if (!set_changed && cell != renderable.cell) {
+      cull_grid_.move(i, renderable.cell, cell);
+    }
+    renderable.cell = cell;
+  }
+
+  // Індекси зсунулися після реєстрації/видалення — сітку перебудовуємо повністю
+  if (set_changed) {
+    rebuild_cull_grid();
+  }
+
+  // Жоден ключ не змінився — попередній порядок досі правильний
+  if (!keys_changed) {
+    return;
+  }
+
+  sort_keys_.resize(renderables_.size());
+  draw_order_.resize(renderables_.size());
+  for (std::uint32_t i = 0; i < renderables_.size(); ++i) {
+    sort_keys_[i] = renderables_[i].sort_key;
+    draw_order_[i] = i;
+  }
+
+  radix_sort(sort_keys_, draw_order_, scratch_keys_, scratch_order_);
+  order_dirty_ = false;
+
+  draw_rank_.resize(renderables_.size());
+  for (std::uint32_t rank = 0; rank < draw_order_.size(); ++rank) {
+    draw_rank_[draw_order_[rank]] = rank;
+  }
+}
+
+void RenderSystem::rebuild_cull_grid() {
+  cull_grid_.clear();
+  for (std::uint32_t i = 0; i < renderables_.size(); ++i) {
+    cull_grid_.insert(i, renderables_[i].cell);
+  }
+}
+
+Rectangle RenderSystem::get_view_bounds() const {
+  if (has_cull_bounds_) {
+    return cull_bounds_;
+  }
+
+  const RenderBackend &backend = RenderBackend::get();
+  const auto screen_width = static_cast<float>(backend.get_screen_width());
+  const auto screen_height = static_cast<float>(backend.get_screen_height());
+  if (!camera_) {
+    return Rectangle{0, 0, screen_width, screen_height};
+  }
+
+  // AABB чотирьох кутів екрана — коректно і для повернутої камери
+  const Vector2 corners[] = {
+    GetScreenToWorld2D({0, 0}, *camera_),
+    GetScreenToWorld2D({screen_width, 0}, *camera_),
+    GetScreenToWorld2D({0, screen_height}, *camera_),
+    GetScreenToWorld2D({screen_width, screen_height}, *camera_)
+  };
+
+  Vector2 min = corners[0];
+  Vector2 max = corners[0];
+  for (const Vector2 &corner : corners) {
+    min = {std::min(min.x, corner.x), std::min(min.y, corner.y)};
+    max = {std::max(max.x, corner.x), std::max(max.y, corner.y)};
+  }
+  return Rectangle{min.x, min.y, max.x - min.x, max.y - min.y};
 }
 
+void RenderSystem::collect_visible(const Rectangle &view) {
+  const float padding = cull_margin_ + max_extent_;
+  const Rectangle query_area = {
+    view.x - padding,
+    view.y - padding,
+    view.width + padding * 2.f,
+    view.height + padding * 2.f
+  };
+
+  visible_.clear();
+  visible_ranks_.clear();
+
+  cull_grid_.query(query_area, [&](const std::uint32_t index) {
+    const Renderable &renderable = renderables_[index];
+    const Vector2 position = renderable.transform->position;
+    const float reach = cull_margin_ + renderable.extent;
 
-void RenderSystem::sort_entities_by_layer() {
-  std::sort(entities_.begin(), entities_.end(), [](Entity* a, Entity* b) {
-    const auto sprite_a = a->get_component<Components::Sprite>();
-    const auto sprite_b = b->get_component<Components::Sprite>();
-    if (!sprite_a || !sprite_b) {
-      return false;
+    if (position.x + reach < view.x || position.x - reach > view.x + view.width ||
+        position.y + reach < view.y || position.y - reach > view.y + view.height) {
+      return;
     }
-    return sprite_a->layer < sprite_b->layer;
+
+    visible_.push_back(index);
+    visible_ranks_.push_back(draw_rank_[index]);
   });
+
+  // Видимі сутності малюємо в тому ж порядку, що й повний draw_order_
+  radix_sort(visible_ranks_, visible_, scratch_keys_, scratch_order_);
+}
+
+void RenderSystem::set_static_layer(const int layer, const Rectangle &world_rect, std::function<void()> draw) {
+  remove_static_layer(layer);
+  static_layers_[layer] = {world_rect, std::move(draw), RenderTexture2D{0, {}, {}}, true};
+}
+
+void RenderSystem::remove_static_layer(const int layer) {
+  if (const auto it = static_layers_.find(layer); it != static_layers_.end()) {
+    if (it->second.target.id != 0) {
+      RenderBackend::get().unload_render_texture(it->second.target);
+    }
+    static_layers_.erase(it);
+  }
+}
+
+void RenderSystem::invalidate_static_layer(const int layer) {
+  if (const auto it = static_layers_.find(layer); it != static_layers_.end()) {
+    it->second.dirty = true;
+  }
+}
+
+void RenderSystem::invalidate_static_layers() {
+  for (StaticLayer &static_layer : static_layers_ | std::views::values) {
+    static_layer.dirty = true;
+  }
+}
+
+void RenderSystem::update_static_layers() {
+  RenderBackend &backend = RenderBackend::get();
+
+  for (StaticLayer &static_layer : static_layers_ | std::views::values) {
+    if (!static_layer.dirty) {
+      continue;
+    }
+
+    // Один піксель текстури на одиницю світу
+    if (static_layer.target.id == 0) {
+      static_layer.target = backend.load_render_texture(static_cast<int>(std::ceil(static_layer.world_rect.width)),
+                                                        static_cast<int>(std::ceil(static_layer.world_rect.height)));
+    }
+
+    const Camera2D layer_camera = {{0, 0}, {static_layer.world_rect.x, static_layer.world_rect.y}, 0.f, 1.f};
+
+    backend.begin_texture_mode(static_layer.target);
+    backend.clear(BLANK);
+    backend.begin_mode_2d(layer_camera);
+    static_layer.draw();
+    backend.end_mode_2d();
+    backend.end_texture_mode();
+
+    static_layer.dirty = false;
+  }
+}
+
+void RenderSystem::draw_static_layer(const int layer, const Rectangle &view) {
+  if (const auto it = static_layers_.find(layer); it != static_layers_.end()) {
+    draw_static_layer(it->second, view);
+  }
+}
+
+void RenderSystem::draw_static_layer(const StaticLayer &static_layer, const Rectangle &view) const {
+  if (static_layer.target.id == 0) {
+    return;
+  }
+
+  const Rectangle &world = static_layer.world_rect;
+  const float left = std::max(view.x, world.x);
+  const float top = std::max(view.y, world.y);
+  const float right = std::min(view.x + view.width, world.x + world.width);
+  const float bottom = std::min(view.y + view.height, world.y + world.height);
+  if (right <= left || bottom <= top) {
+    return;
+  }
+
+  // Render texture у OpenGL перевернута по Y — беремо дзеркальний прямокутник з від'ємною висотою
+  const auto texture_height = static_cast<float>(static_layer.target.texture.height);
+  const Rectangle source = {
+    left - world.x,
+    texture_height - (bottom - world.y),
+    right - left,
+    -(bottom - top)
+  };
+  const Rectangle dest = {left, top, right - left, bottom - top};
+
+  RenderBackend::get().draw_texture(static_layer.target.texture, source, dest, {0, 0}, 0.f, WHITE);
 }
 
 void RenderSystem::clear_entities() {
-  entities_.clear();
+  renderables_.clear();
+  draw_order_.clear();
+  draw_rank_.clear();
+  visible_.clear();
+  cull_grid_.clear();
+  order_dirty_ = true;
   TRACELOG(LOG_INFO, "RenderSystem cleared all entities");
 }
 
@@ -1,46 +1,152 @@
 #pragma once
+#include <cstdint>
+#include <functional>
+#include <map>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 #include "raylib.h"
 #include "../components/Transform.h"
 #include "../components/Sprite.h"
+#include "../core/SpatialGrid.h"
+#include "PrimitiveRenderer.h"
+#include "TextureAtlas.h"
 
 class Entity;
 
+struct RenderStats {
+  size_t visible = 0;
+  size_t culled = 0;
+  size_t draw_calls = 0;
+  // Зміни прив'язаної текстури між сусідніми викликами — кожна скидає пакет rlgl
+  size_t batch_flushes = 0;
+};
+
 class RenderSystem {
-private:
-  std::vector<Entity*> entities_;
+public:
+  static constexpr float DEFAULT_CULL_CELL_SIZE = 256.f;
+  static constexpr float DEFAULT_CULL_MARGIN = 32.f;
+  // Пакети статичних шарів не перетинаються зі сторінками атласу (page + 1 < 0x10000)
+  static constexpr std::uint32_t STATIC_LAYER_BATCH = 0x10000;
 
-  std::unordered_map<std::string, Texture2D> textures_;
+private:
+  // Вказівники на компоненти кешуються при реєстрації, щоб не шукати їх щокадру
+  struct Renderable {
+    Entity* entity;
+    Components::Transform* transform;
+    Components::Sprite* sprite;
+    std::uint64_t sort_key;
+    SpatialGrid::CellKey cell;
+    float extent;
+  };
+
+  std::vector<Renderable> renderables_;
+
+  // Індексуються хендлом TextureRegistry; слот 0 — заглушка для незавантажених текстур.
+  // CPU-копії зображень лишаються, щоб атлас можна було перепакувати після нового завантаження
+  std::vector<Image> images_;
+  std::vector<AtlasRegion> regions_;
+
+  TextureAtlas atlas_;
+  bool atlas_enabled_ = true;
+  bool atlas_dirty_ = false;
+  std::uint32_t bound_batch_ = 0;
+
+  // Примітиви накопичуються, поки не трапиться спрайт з текстурою, і йдуть одним пакетом
+  PrimitiveRenderer primitive_renderer_;
+
+  // Статичний шар малюється один раз у RenderTexture і далі показується одним квадом
+  struct StaticLayer {
+    Rectangle world_rect;
+    std::function<void()> draw;
+    RenderTexture2D target;
+    bool dirty;
+  };
+  std::map<int, StaticLayer> static_layers_;
+
+  // Порядок малювання: індекси в renderables_, відсортовані за sort_key
+  std::vector<std::uint32_t> draw_order_;
+  std::vector<std::uint64_t> sort_keys_;
+  std::vector<std::uint64_t> scratch_keys_;
+  std::vector<std::uint32_t> scratch_order_;
+  bool order_dirty_ = true;
+
+  // Відсікання за камерою: сітка за позиціями і ранг кожного renderable у draw_order_
+  SpatialGrid cull_grid_{DEFAULT_CULL_CELL_SIZE};
+  std::vector<std::uint32_t> draw_rank_;
+  std::vector<std::uint32_t> visible_;
+  std::vector<std::uint64_t> visible_ranks_;
+  float max_extent_ = 0.f;
+  float cull_margin_ = DEFAULT_CULL_MARGIN;
+  Rectangle cull_bounds_ = {0, 0, 0, 0};
+  bool has_cull_bounds_ = false;
+  bool culling_enabled_ = true;
+  RenderStats stats_;
 
   Camera2D* camera_ = nullptr;
 
 public:
 
-  RenderSystem() = default;
+  RenderSystem();
   ~RenderSystem();
 
   void register_entity(Entity* entity);
   void unregister_entity(const Entity* entity);
 
-  void load_texture(const std::string& name, const std::string& path);
+  TextureHandle load_texture(const std::string& name, const std::string& path);
+  // Забирає зображення у власність і одразу дописує його в атлас; false — власність лишається у викликача
+  bool add_image(TextureHandle handle, const Image& image);
   void unload_all_textures();
 
   void set_camera(Camera2D* camera) { camera_ = camera; }
 
+  // Явна видима область у світових координатах; без неї береться з camera_ і розміру екрана
+  void set_cull_bounds(const Rectangle& bounds) { cull_bounds_ = bounds; has_cull_bounds_ = true; }
+  void reset_cull_bounds() { has_cull_bounds_ = false; }
+  void set_cull_margin(float margin) { cull_margin_ = margin; }
+  void set_culling_enabled(bool enabled) { culling_enabled_ = enabled; }
+
+  const RenderStats& get_stats() const { return stats_; }
+
+  // draw малює у світових координатах в межах world_rect; шар з тим самим індексом замінюється.
+  // У render() шар іде перед спрайтами свого і вищих шарів
+  void set_static_layer(int layer, const Rectangle& world_rect, std::function<void()> draw);
+  void remove_static_layer(int layer);
+  void invalidate_static_layer(int layer);
+  void invalidate_static_layers();
+
+  // Перемальовує застарілі шари; викликати поза BeginMode2D, бо BeginTextureMode скидає матрицю камери
+  void update_static_layers();
+  // Малює лише видиму частину шару; викликати всередині режиму камери
+  void draw_static_layer(int layer, const Rectangle& view);
+
+  // Без атласу кожна текстура стає окремою сторінкою — для порівняння лічильників
+  void set_atlas_enabled(bool enabled);
+  size_t get_atlas_page_count() const { return atlas_.get_page_count(); }
+
   void render();
 
   void clear_entities();
 
+  // Ключ: [63..48] шар, [47..32] пакет (сторінка атласу + 1, 0 для примітивів), [31..0] глибина по Y
+  static std::uint64_t make_sort_key(int layer, std::uint16_t batch_id, float y_depth);
+
 private:
 
   bool is_valid_entity(const Entity* entity);
 
-  void render_entity(const Entity* entity);
+  void render_renderable(const Renderable& renderable);
   void render_primitive(const Components::Transform *transform, const Components::Sprite* sprite);
-  void render_sprite_texture(const Components::Transform *transform, const Components::Sprite *sprite);
-
-  void sort_entities_by_layer();
+  void render_sprite_texture(const Renderable& renderable);
+  void bind_batch(std::uint32_t batch_id);
+
+  void rebuild_atlas();
+  const AtlasRegion& get_region(TextureHandle handle) const;
+  std::uint16_t get_batch_id(const Renderable& renderable) const;
+  float compute_extent(const Renderable& renderable) const;
+  void update_draw_order();
+  void rebuild_cull_grid();
+  Rectangle get_view_bounds() const;
+  void draw_static_layer(const StaticLayer& static_layer, const Rectangle& view) const;
+  void collect_visible(const Rectangle& view);
 };
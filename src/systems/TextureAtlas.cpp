@@ -0,0 +1,154 @@
+#include "TextureAtlas.h"
+
+#include <algorithm>
+
+#include "utils.h"
+#include "render/RenderBackend.h"
+
+TextureAtlas::~TextureAtlas() {
+  unload();
+}
+
+void TextureAtlas::build(const std::vector<Image> &images, std::vector<AtlasRegion> &regions, const bool separate_pages) {
+  unload();
+  separate_pages_ = separate_pages;
+  regions.assign(images.size(), AtlasRegion{});
+
+  // Вищі зображення першими — полиці виходять щільнішими
+  std::vector<size_t> order;
+  order.reserve(images.size());
+  for (size_t i = 0; i < images.size(); ++i) {
+    if (images[i].data != nullptr) {
+      order.push_back(i);
+    }
+  }
+  std::ranges::stable_sort(order, std::greater{}, [&](const size_t i) { return images[i].height; });
+
+  struct PageLayout {
+    int width = 0;
+    int height = 0;
+    std::vector<size_t> items;
+    bool direct = false;
+  };
+  std::vector<PageLayout> layouts;
+
+  int shelf_x = 0;
+  int shelf_y = 0;
+  int shelf_height = 0;
+  bool page_open = false;
+
+  for (const size_t i : order) {
+    const int width = images[i].width + PADDING;
+    const int height = images[i].height + PADDING;
+
+    // Завеликі зображення (і режим без атласу) отримують окрему сторінку
+    if (separate_pages || width > page_size_ || height > page_size_) {
+      layouts.push_back({images[i].width, images[i].height, {i}, true});
+      regions[i] = {static_cast<std::uint16_t>(layouts.size() - 1),
+                    Rectangle{0, 0, static_cast<float>(images[i].width), static_cast<float>(images[i].height)}};
+      page_open = false;
+      continue;
+    }
+
+    if (page_open && shelf_x + width > page_size_) {
+      shelf_y += shelf_height;
+      shelf_x = 0;
+      shelf_height = 0;
+    }
+
+    if (!page_open || shelf_y + height > page_size_) {
+      layouts.emplace_back();
+      shelf_x = 0;
+      shelf_y = 0;
+      shelf_height = 0;
+      page_open = true;
+    }
+
+    PageLayout &layout = layouts.back();
+    regions[i] = {static_cast<std::uint16_t>(layouts.size() - 1),
+                  Rectangle{static_cast<float>(shelf_x), static_cast<float>(shelf_y),
+                            static_cast<float>(images[i].width), static_cast<float>(images[i].height)}};
+    layout.items.push_back(i);
+    layout.width = std::max(layout.width, shelf_x + width);
+    layout.height = std::max(layout.height, shelf_y + height);
+
+    shelf_x += width;
+    shelf_height = std::max(shelf_height, height);
+  }
+
+  // Сторінка займає лише використану площу, а не весь page_size_ x page_size_
+  for (const PageLayout &layout : layouts) {
+    if (layout.direct) {
+      pages_.push_back(RenderBackend::get().load_texture(images[layout.items[0]]));
+      continue;
+    }
+
+    Image page = GenImageColor(layout.width, layout.height, BLANK);
+    for (const size_t i : layout.items) {
+      const Image &image = images[i];
+      ImageDraw(&page, image,
+                Rectangle{0, 0, static_cast<float>(image.width), static_cast<float>(image.height)},
+                regions[i].rect, WHITE);
+    }
+    pages_.push_back(RenderBackend::get().load_texture(page));
+    UnloadImage(page);
+  }
+
+  TRACELOG(LOG_INFO, "Texture atlas built: %zu images in %zu pages", order.size(), pages_.size());
+}
+
+AtlasRegion TextureAtlas::insert(const Image &image) {
+  const int width = image.width + PADDING;
+  const int height = image.height + PADDING;
+
+  if (separate_pages_ || width > page_size_ || height > page_size_) {
+    pages_.push_back(RenderBackend::get().load_texture(image));
+    return {static_cast<std::uint16_t>(pages_.size() - 1),
+            Rectangle{0, 0, static_cast<float>(image.width), static_cast<float>(image.height)}};
+  }
+
+  if (open_page_ >= 0 && shelf_x_ + width > page_size_) {
+    shelf_y_ += shelf_height_;
+    shelf_x_ = 0;
+    shelf_height_ = 0;
+  }
+
+  // Сторінки після build() обрізані під вміст, тож дозапис завжди йде в окрему повнорозмірну
+  if (open_page_ < 0 || shelf_y_ + height > page_size_) {
+    const Image blank = GenImageColor(page_size_, page_size_, BLANK);
+    pages_.push_back(RenderBackend::get().load_texture(blank));
+    UnloadImage(blank);
+    open_page_ = static_cast<int>(pages_.size() - 1);
+    shelf_x_ = 0;
+    shelf_y_ = 0;
+    shelf_height_ = 0;
+  }
+
+  const AtlasRegion region = {
+    static_cast<std::uint16_t>(open_page_),
+    Rectangle{static_cast<float>(shelf_x_), static_cast<float>(shelf_y_),
+              static_cast<float>(image.width), static_cast<float>(image.height)}
+  };
+
+  // update_texture_rec чекає пікселі у форматі сторінки
+  if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) {
+    RenderBackend::get().update_texture_rec(pages_[open_page_], region.rect, image.data);
+  } else {
+    Image converted = ImageCopy(image);
+    ImageFormat(&converted, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    RenderBackend::get().update_texture_rec(pages_[open_page_], region.rect, converted.data);
+    UnloadImage(converted);
+  }
+
+  shelf_x_ += width;
+  shelf_height_ = std::max(shelf_height_, height);
+  return region;
+}
+
+void TextureAtlas::unload() {
+  for (const Texture2D &page : pages_) {
+    RenderBackend::get().unload_texture(page);
+  }
+  pages_.clear();
+  open_page_ = -1;
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "raylib.h"
+
+// Прямокутник текстури всередині сторінки атласу
+struct AtlasRegion {
+  std::uint16_t page = 0;
+  Rectangle rect = {0, 0, 0, 0};
+};
+
+// Пакує зображення полицями (shelf packing) у кілька сторінок-текстур
+class TextureAtlas {
+public:
+  static constexpr int DEFAULT_PAGE_SIZE = 2048;
+  static constexpr int PADDING = 2;
+
+private:
+  int page_size_;
+  std::vector<Texture2D> pages_;
+  bool separate_pages_ = false;
+
+  // Сторінка для дозапису: повнорозмірна, полиця продовжується з місця зупинки
+  int open_page_ = -1;
+  int shelf_x_ = 0;
+  int shelf_y_ = 0;
+  int shelf_height_ = 0;
+
+public:
+  explicit TextureAtlas(int page_size = DEFAULT_PAGE_SIZE) : page_size_(page_size) {}
+  ~TextureAtlas();
+
+  TextureAtlas(const TextureAtlas&) = delete;
+  TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+  // regions[i] відповідає images[i]; separate_pages кладе кожне зображення на власну сторінку.
+  // Порожні слоти (data == nullptr) пропускаються і отримують нульовий регіон
+  void build(const std::vector<Image> &images, std::vector<AtlasRegion> &regions, bool separate_pages);
+  // Дописує одне зображення без перепакування решти і вантажить на GPU лише його прямокутник
+  AtlasRegion insert(const Image &image);
+  void unload();
+
+  const Texture2D& get_page(std::uint16_t page) const { return pages_[page]; }
+  size_t get_page_count() const { return pages_.size(); }
+  int get_page_size() const { return page_size_; }
+};
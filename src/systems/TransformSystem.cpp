@@ -16,7 +16,16 @@ void TransformSystem::register_entity(Entity *entity) {
     return;
   }
 
-  entities_.push_back(entity);
+  if (const auto it = std::ranges::find(sleeping_, entity, &SleepingEntity::entity); it != sleeping_.end()) {
+    TRACELOG(LOG_WARNING, "Entity %d already registered in TransformSystem!", entity->get_id());
+    return;
+  }
+
+  if (Components::Transform *transform = entity->get_component<Components::Transform>(); transform->sleeping) {
+    sleeping_.push_back({entity, transform});
+  } else {
+    entities_.push_back(entity);
+  }
   TRACELOG(LOG_INFO, "Entity %d registered in TransformSystem", entity->get_id());
 }
 
@@ -24,23 +33,92 @@ void TransformSystem::unregister_entity(const Entity *entity) {
   if (const auto it = std::ranges::find(entities_, entity); it != entities_.end()) {
     entities_.erase(it);
     TRACELOG(LOG_INFO, "Entity %d unregistered from TransformSystem", entity->get_id());
+    return;
+  }
+
+  if (const auto it = std::ranges::find(sleeping_, entity, &SleepingEntity::entity); it != sleeping_.end()) {
+    sleeping_.erase(it);
+    TRACELOG(LOG_INFO, "Entity %d unregistered from TransformSystem (sleeping)", entity->get_id());
   }
 }
 
+void TransformSystem::reserve(const size_t capacity) {
+  entities_.reserve(capacity);
+  sleeping_.reserve(capacity);
+}
+
 void TransformSystem::update(const float delta_time) {
-  for (const Entity *entity : entities_) {
+  wake_sleeping_entities();
+
+  for (size_t i = 0; i < entities_.size();) {
+    Entity *entity = entities_[i];
     if (!is_valid_entity(entity)) {
+      ++i;
       continue;
     }
 
     Components::Transform *transform = entity->get_component<Components::Transform>();
+
+    if (transform->is_at_rest()) {
+      // Entity, що стоїть N кадрів поспіль, переходить у sleeping_ і більше не інтегрується
+      if (sleeping_enabled_ && ++transform->rest_frames >= sleep_frames_) {
+        transform->sleeping = true;
+        sleeping_.push_back({entity, transform});
+        entities_[i] = entities_.back();
+        entities_.pop_back();
+        TRACELOG(LOG_INFO, "Entity %d fell asleep", entity->get_id());
+        continue;
+      }
+      ++i;
+      continue;
+    }
+
+    transform->rest_frames = 0;
     transform->position.x += transform->velocity.x * delta_time;
     transform->position.y += transform->velocity.y * delta_time;
 
+    TRACELOG(LOG_INFO, "Entity %d moved to (%f, %f)", entity->get_id(), transform->position.x, transform->position.y);
+    ++i;
+  }
+}
 
-    if (transform->velocity.x != 0.0f || transform->velocity.y != 0.0f) {
-      TRACELOG(LOG_INFO, "Entity %d moved to (%f, %f)", entity->get_id(), transform->position.x, transform->position.y);
+void TransformSystem::wake_sleeping_entities() {
+  // Сплячі entities не інтегруються, але зміна швидкості або явний wake() повертає їх назад
+  for (size_t i = 0; i < sleeping_.size();) {
+    const auto [entity, transform] = sleeping_[i];
+    if (transform->sleeping && transform->is_at_rest()) {
+      ++i;
+      continue;
     }
+
+    transform->wake();
+    entities_.push_back(entity);
+    sleeping_[i] = sleeping_.back();
+    sleeping_.pop_back();
+    TRACELOG(LOG_INFO, "Entity %d woke up", entity->get_id());
+  }
+}
+
+void TransformSystem::wake(const Entity *entity) {
+  if (!is_valid_entity(entity)) {
+    return;
+  }
+
+  entity->get_component<Components::Transform>()->wake();
+}
+
+void TransformSystem::wake_all() {
+  for (const auto &[entity, transform] : sleeping_) {
+    transform->wake();
+    entities_.push_back(entity);
+  }
+  sleeping_.clear();
+}
+
+void TransformSystem::set_sleeping_enabled(const bool enabled) {
+  sleeping_enabled_ = enabled;
+  if (!sleeping_enabled_) {
+    wake_all();
   }
 }
 
@@ -51,6 +129,9 @@ void TransformSystem::set_velocity(const Entity *entity, const Vector2 velocity)
 
   Components::Transform *transform = entity->get_component<Components::Transform>();
   transform->velocity = velocity;
+  if (!transform->is_at_rest()) {
+    transform->wake();
+  }
 }
 
 void TransformSystem::set_position(const Entity *entity, const Vector2 position) {
@@ -60,6 +141,7 @@ void TransformSystem::set_position(const Entity *entity, const Vector2 position)
 
   Components::Transform *transform = entity->get_component<Components::Transform>();
   transform->position = position;
+  transform->wake();
 }
 
 void TransformSystem::move(const Entity *entity, const Vector2 offset) {
@@ -70,6 +152,7 @@ void TransformSystem::move(const Entity *entity, const Vector2 offset) {
   Components::Transform *transform = entity->get_component<Components::Transform>();
   transform->position.x += offset.x;
   transform->position.y += offset.y;
+  transform->wake();
 }
 
 Vector2 TransformSystem::get_position(const Entity *entity) {
@@ -108,6 +191,7 @@ void TransformSystem::clamp_to_world_bounds(const Entity *entity, const Rectangl
 
 void TransformSystem::clear_entities() {
   entities_.clear();
+  sleeping_.clear();
   TRACELOG(LOG_INFO, "TransformSystem cleared all entities");
 }
 
@@ -6,12 +6,26 @@
 class Entity;
 
 class TransformSystem {
+public:
+  static constexpr unsigned int DEFAULT_SLEEP_FRAMES = 30;
+
 private:
+  struct SleepingEntity {
+    Entity *entity;
+    Components::Transform *transform;
+  };
+
   std::vector<Entity *> entities_;
+  std::vector<SleepingEntity> sleeping_;
+
+  unsigned int sleep_frames_ = DEFAULT_SLEEP_FRAMES;
+  bool sleeping_enabled_ = true;
 
 public:
   void register_entity(Entity *entity);
   void unregister_entity(const Entity *entity);
+  // Резерв під очікувану кількість сутностей — реєстрація тоді не виділяє пам'яті
+  void reserve(size_t capacity);
 
   void update(float delta_time);
 
@@ -25,8 +39,21 @@ public:
 
   static void clamp_to_world_bounds(const Entity *entity, Rectangle world_bounds);
 
+  // Будить entity; фактично повертається в активний список на наступному update()
+  static void wake(const Entity *entity);
+
+  void wake_all();
+
+  void set_sleep_frames(unsigned int frames) { sleep_frames_ = frames; }
+  void set_sleeping_enabled(bool enabled);
+
+  size_t get_awake_count() const { return entities_.size(); }
+  size_t get_sleeping_count() const { return sleeping_.size(); }
+
   void clear_entities();
 
 private:
   static bool is_valid_entity(const Entity *entity);
+
+  void wake_sleeping_entities();
 };
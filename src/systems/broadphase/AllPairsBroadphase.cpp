@@ -0,0 +1,32 @@
+#include "AllPairsBroadphase.h"
+
+void AllPairsBroadphase::build_pairs(const std::vector<BroadphaseProxy> &proxies,
+                                     std::vector<BroadphasePair> &out_pairs) {
+  awake_.clear();
+  sleeping_.clear();
+  for (std::uint32_t i = 0; i < proxies.size(); ++i) {
+    (proxies[i].sleeping ? sleeping_ : awake_).push_back(i);
+  }
+
+  // awake x awake
+  for (size_t i = 0; i < awake_.size(); ++i) {
+    const BroadphaseProxy &a = proxies[awake_[i]];
+    for (size_t j = i + 1; j < awake_.size(); ++j) {
+      const BroadphaseProxy &b = proxies[awake_[j]];
+      if (overlaps(a.bounds, b.bounds)) {
+        out_pairs.push_back({a.index, b.index});
+      }
+    }
+  }
+
+  // awake x sleeping
+  for (const std::uint32_t awake_index : awake_) {
+    const BroadphaseProxy &a = proxies[awake_index];
+    for (const std::uint32_t sleeping_index : sleeping_) {
+      const BroadphaseProxy &b = proxies[sleeping_index];
+      if (overlaps(a.bounds, b.bounds)) {
+        out_pairs.push_back({a.index, b.index});
+      }
+    }
+  }
+}
@@ -0,0 +1,14 @@
+#pragma once
+#include "Broadphase.h"
+
+class AllPairsBroadphase final : public Broadphase {
+private:
+  std::vector<std::uint32_t> awake_;
+  std::vector<std::uint32_t> sleeping_;
+
+public:
+  BroadphaseType get_type() const override { return BroadphaseType::ALL_PAIRS; }
+
+protected:
+  void build_pairs(const std::vector<BroadphaseProxy> &proxies, std::vector<BroadphasePair> &out_pairs) override;
+};
@@ -0,0 +1,51 @@
+#include "Broadphase.h"
+
+#include <chrono>
+
+#include "AllPairsBroadphase.h"
+#include "GridBroadphase.h"
+#include "SweepAndPruneBroadphase.h"
+#include "TreeBroadphase.h"
+
+const char *to_string(const BroadphaseType type) {
+  switch (type) {
+    case BroadphaseType::ALL_PAIRS:
+      return "AllPairs";
+    case BroadphaseType::GRID:
+      return "Grid";
+    case BroadphaseType::SWEEP_AND_PRUNE:
+      return "SweepAndPrune";
+    case BroadphaseType::TREE:
+      return "Tree";
+    default:
+      return "Unknown";
+  }
+}
+
+void Broadphase::find_pairs(const std::vector<BroadphaseProxy> &proxies, std::vector<BroadphasePair> &out_pairs) {
+  const auto start = std::chrono::steady_clock::now();
+
+  out_pairs.clear();
+  build_pairs(proxies, out_pairs);
+
+  const auto end = std::chrono::steady_clock::now();
+
+  stats_.proxy_count = proxies.size();
+  stats_.candidate_pairs = out_pairs.size();
+  stats_.true_hits = 0;
+  stats_.build_time_ms = std::chrono::duration<float, std::milli>(end - start).count();
+}
+
+std::unique_ptr<Broadphase> Broadphase::create(const BroadphaseType type, const float cell_size) {
+  switch (type) {
+    case BroadphaseType::GRID:
+      return std::make_unique<GridBroadphase>(cell_size);
+    case BroadphaseType::SWEEP_AND_PRUNE:
+      return std::make_unique<SweepAndPruneBroadphase>();
+    case BroadphaseType::TREE:
+      return std::make_unique<TreeBroadphase>();
+    case BroadphaseType::ALL_PAIRS:
+    default:
+      return std::make_unique<AllPairsBroadphase>();
+  }
+}
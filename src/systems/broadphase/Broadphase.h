@@ -0,0 +1,63 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "raylib.h"
+
+struct BroadphaseProxy {
+  Rectangle bounds;
+  std::uint32_t index;
+  bool sleeping;
+};
+
+struct BroadphasePair {
+  std::uint32_t a;
+  std::uint32_t b;
+};
+
+struct BroadphaseStats {
+  size_t proxy_count = 0;
+  size_t candidate_pairs = 0;
+  size_t true_hits = 0;
+  float build_time_ms = 0.f;
+};
+
+enum class BroadphaseType {
+  ALL_PAIRS,
+  GRID,
+  SWEEP_AND_PRUNE,
+  TREE
+};
+
+const char *to_string(BroadphaseType type);
+
+class Broadphase {
+protected:
+  BroadphaseStats stats_;
+
+public:
+  virtual ~Broadphase() = default;
+
+  virtual BroadphaseType get_type() const = 0;
+
+  // Повертає кандидатні пари з перетином AABB; пари sleeping x sleeping відкидаються
+  void find_pairs(const std::vector<BroadphaseProxy> &proxies, std::vector<BroadphasePair> &out_pairs);
+
+  void report_true_hits(const size_t hits) { stats_.true_hits = hits; }
+
+  const BroadphaseStats &get_stats() const { return stats_; }
+
+  static std::unique_ptr<Broadphase> create(BroadphaseType type, float cell_size);
+
+protected:
+  virtual void build_pairs(const std::vector<BroadphaseProxy> &proxies, std::vector<BroadphasePair> &out_pairs) = 0;
+
+  static bool overlaps(const Rectangle &a, const Rectangle &b) {
+    return a.x <= b.x + b.width && b.x <= a.x + a.width && a.y <= b.y + b.height && b.y <= a.y + a.height;
+  }
+
+  static bool accepts(const BroadphaseProxy &a, const BroadphaseProxy &b) {
+    return !(a.sleeping && b.sleeping) && overlaps(a.bounds, b.bounds);
+  }
+};
@@ -0,0 +1,59 @@
+#include "BroadphaseTuner.h"
+
+#include <algorithm>
+
+bool BroadphaseTuner::should_sample() {
+  if (frames_until_sample_ > 0) {
+    --frames_until_sample_;
+    return false;
+  }
+
+  frames_until_sample_ = sample_interval_ - 1;
+  return true;
+}
+
+BroadphaseChoice BroadphaseTuner::choose(const std::vector<BroadphaseProxy> &proxies) {
+  BroadphaseChoice choice;
+  if (proxies.size() <= SMALL_SCENE_PROXIES) {
+    choice.type = BroadphaseType::ALL_PAIRS;
+    return choice;
+  }
+
+  float min_x = proxies.front().bounds.x;
+  float min_y = proxies.front().bounds.y;
+  float max_x = min_x;
+  float max_y = min_y;
+  float size_sum = 0.f;
+  float size_max = 0.f;
+
+  for (const BroadphaseProxy &proxy : proxies) {
+    const Rectangle &b = proxy.bounds;
+    min_x = std::min(min_x, b.x);
+    min_y = std::min(min_y, b.y);
+    max_x = std::max(max_x, b.x + b.width);
+    max_y = std::max(max_y, b.y + b.height);
+
+    const float size = std::max(b.width, b.height);
+    size_sum += size;
+    size_max = std::max(size_max, size);
+  }
+
+  const float average_size = std::max(1.f, size_sum / static_cast<float>(proxies.size()));
+  const float extent_x = std::max(1.f, max_x - min_x);
+  const float extent_y = std::max(1.f, max_y - min_y);
+  const float aspect = std::max(extent_x / extent_y, extent_y / extent_x);
+
+  choice.cell_size = std::clamp(average_size * 2.f, MIN_CELL_SIZE, MAX_CELL_SIZE);
+
+  if (size_max > average_size * MIXED_SIZE_RATIO) {
+    // Сітка погано працює з колайдерами дуже різного розміру
+    choice.type = BroadphaseType::TREE;
+  } else if (aspect > ELONGATED_ASPECT) {
+    // Витягнута сцена майже одновимірна — sweep по довшій осі відсікає найбільше
+    choice.type = BroadphaseType::SWEEP_AND_PRUNE;
+  } else {
+    choice.type = BroadphaseType::GRID;
+  }
+
+  return choice;
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <vector>
+
+#include "Broadphase.h"
+
+struct BroadphaseChoice {
+  BroadphaseType type = BroadphaseType::ALL_PAIRS;
+  float cell_size = 64.f;
+};
+
+// Раз на кілька кадрів оцінює щільність сцени і середній розмір колайдерів
+class BroadphaseTuner {
+public:
+  static constexpr unsigned int DEFAULT_SAMPLE_INTERVAL = 60;
+  static constexpr size_t SMALL_SCENE_PROXIES = 32;
+  static constexpr float MIXED_SIZE_RATIO = 8.f;
+  static constexpr float ELONGATED_ASPECT = 4.f;
+  static constexpr float MIN_CELL_SIZE = 8.f;
+  static constexpr float MAX_CELL_SIZE = 512.f;
+
+private:
+  unsigned int sample_interval_ = DEFAULT_SAMPLE_INTERVAL;
+  unsigned int frames_until_sample_ = 0;
+
+public:
+  void set_sample_interval(const unsigned int frames) { sample_interval_ = frames > 0 ? frames : 1; }
+
+  bool should_sample();
+
+  static BroadphaseChoice choose(const std::vector<BroadphaseProxy> &proxies);
+};
@@ -0,0 +1,85 @@
+#include "GridBroadphase.h"
+
+#include <algorithm>
+#include <cmath>
+
+GridBroadphase::GridBroadphase(const float cell_size)
+  : cell_size_(std::max(1.f, cell_size)) {
+}
+
+int GridBroadphase::to_cell(const float coordinate) const {
+  return static_cast<int>(std::floor(coordinate / cell_size_));
+}
+
+std::uint64_t GridBroadphase::cell_key(const int x, const int y) {
+  return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+}
+
+void GridBroadphase::build_pairs(const std::vector<BroadphaseProxy> &proxies, std::vector<BroadphasePair> &out_pairs) {
+  entries_.clear();
+  oversized_.clear();
+
+  for (std::uint32_t i = 0; i < proxies.size(); ++i) {
+    const Rectangle &bounds = proxies[i].bounds;
+    const int x0 = to_cell(bounds.x);
+    const int y0 = to_cell(bounds.y);
+    const int x1 = to_cell(bounds.x + bounds.width);
+    const int y1 = to_cell(bounds.y + bounds.height);
+
+    if ((x1 - x0 + 1) * (y1 - y0 + 1) > MAX_CELLS_PER_PROXY) {
+      oversized_.push_back(i);
+      continue;
+    }
+
+    for (int y = y0; y <= y1; ++y) {
+      for (int x = x0; x <= x1; ++x) {
+        entries_.push_back({cell_key(x, y), i});
+      }
+    }
+  }
+
+  std::ranges::sort(entries_, [](const CellEntry &a, const CellEntry &b) {
+    return a.cell != b.cell ? a.cell < b.cell : a.proxy < b.proxy;
+  });
+
+  for (size_t begin = 0; begin < entries_.size();) {
+    size_t end = begin + 1;
+    while (end < entries_.size() && entries_[end].cell == entries_[begin].cell) {
+      ++end;
+    }
+
+    for (size_t i = begin; i < end; ++i) {
+      const BroadphaseProxy &a = proxies[entries_[i].proxy];
+      for (size_t j = i + 1; j < end; ++j) {
+        const BroadphaseProxy &b = proxies[entries_[j].proxy];
+        if (!accepts(a, b)) {
+          continue;
+        }
+
+        // Пара, що ділить кілька клітинок, звітується лише в клітинці з кутом перетину
+        const int corner_x = to_cell(std::max(a.bounds.x, b.bounds.x));
+        const int corner_y = to_cell(std::max(a.bounds.y, b.bounds.y));
+        if (cell_key(corner_x, corner_y) == entries_[begin].cell) {
+          out_pairs.push_back({a.index, b.index});
+        }
+      }
+    }
+    begin = end;
+  }
+
+  for (size_t i = 0; i < oversized_.size(); ++i) {
+    const BroadphaseProxy &a = proxies[oversized_[i]];
+    for (std::uint32_t j = 0; j < proxies.size(); ++j) {
+      if (j == oversized_[i]) {
+        continue;
+      }
+      // Пари двох oversized proxies звітуються лише один раз
+      if (j < oversized_[i] && std::ranges::binary_search(oversized_, j)) {
+        continue;
+      }
+      if (accepts(a, proxies[j])) {
+        out_pairs.push_back({a.index, proxies[j].index});
+      }
+    }
+  }
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include "Broadphase.h"
+
+class GridBroadphase final : public Broadphase {
+private:
+  // Proxy, що накриває більше клітинок, перевіряється окремо проти всіх
+  static constexpr int MAX_CELLS_PER_PROXY = 64;
+
+  struct CellEntry {
+    std::uint64_t cell;
+    std::uint32_t proxy;
+  };
+
+  float cell_size_;
+  std::vector<CellEntry> entries_;
+  std::vector<std::uint32_t> oversized_;
+
+public:
+  explicit GridBroadphase(float cell_size);
+
+  BroadphaseType get_type() const override { return BroadphaseType::GRID; }
+
+  float get_cell_size() const { return cell_size_; }
+
+protected:
+  void build_pairs(const std::vector<BroadphaseProxy> &proxies, std::vector<BroadphasePair> &out_pairs) override;
+
+private:
+  int to_cell(float coordinate) const;
+  static std::uint64_t cell_key(int x, int y);
+};
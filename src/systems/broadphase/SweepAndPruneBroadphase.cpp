@@ -0,0 +1,74 @@
+#include "SweepAndPruneBroadphase.h"
+
+#include <algorithm>
+#include <numeric>
+
+bool SweepAndPruneBroadphase::choose_sweep_x(const std::vector<BroadphaseProxy> &proxies) {
+  if (proxies.empty()) {
+    return true;
+  }
+
+  float min_x = proxies.front().bounds.x;
+  float max_x = min_x;
+  float min_y = proxies.front().bounds.y;
+  float max_y = min_y;
+  for (const BroadphaseProxy &proxy : proxies) {
+    min_x = std::min(min_x, proxy.bounds.x);
+    max_x = std::max(max_x, proxy.bounds.x);
+    min_y = std::min(min_y, proxy.bounds.y);
+    max_y = std::max(max_y, proxy.bounds.y);
+  }
+  return max_x - min_x >= max_y - min_y;
+}
+
+void SweepAndPruneBroadphase::build_pairs(const std::vector<BroadphaseProxy> &proxies,
+                                          std::vector<BroadphasePair> &out_pairs) {
+  // Сортуємо вздовж довшої осі сцени
+  const bool sweep_x = choose_sweep_x(proxies);
+  const auto axis_min = [&proxies, sweep_x](const std::uint32_t i) {
+    return sweep_x ? proxies[i].bounds.x : proxies[i].bounds.y;
+  };
+  const auto axis_max = [&proxies, sweep_x](const std::uint32_t i) {
+    const Rectangle &b = proxies[i].bounds;
+    return sweep_x ? b.x + b.width : b.y + b.height;
+  };
+
+  if (order_.size() != proxies.size() || sweep_x != sweep_x_) {
+    sweep_x_ = sweep_x;
+    order_.resize(proxies.size());
+    std::iota(order_.begin(), order_.end(), 0u);
+    std::ranges::sort(order_, {}, axis_min);
+  } else {
+    for (size_t i = 1; i < order_.size(); ++i) {
+      const std::uint32_t current = order_[i];
+      const float key = axis_min(current);
+      size_t j = i;
+      while (j > 0 && axis_min(order_[j - 1]) > key) {
+        order_[j] = order_[j - 1];
+        --j;
+      }
+      order_[j] = current;
+    }
+  }
+
+  active_.clear();
+  for (const std::uint32_t index : order_) {
+    const BroadphaseProxy &proxy = proxies[index];
+    const float start = axis_min(index);
+
+    for (size_t k = 0; k < active_.size();) {
+      if (axis_max(active_[k]) < start) {
+        active_[k] = active_.back();
+        active_.pop_back();
+        continue;
+      }
+
+      if (const BroadphaseProxy &other = proxies[active_[k]]; accepts(proxy, other)) {
+        out_pairs.push_back({other.index, proxy.index});
+      }
+      ++k;
+    }
+
+    active_.push_back(index);
+  }
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include "Broadphase.h"
+
+class SweepAndPruneBroadphase final : public Broadphase {
+private:
+  // Порядок зберігається між кадрами, тож insertion sort майже лінійний
+  std::vector<std::uint32_t> order_;
+  std::vector<std::uint32_t> active_;
+  bool sweep_x_ = true;
+
+public:
+  BroadphaseType get_type() const override { return BroadphaseType::SWEEP_AND_PRUNE; }
+
+protected:
+  void build_pairs(const std::vector<BroadphaseProxy> &proxies, std::vector<BroadphasePair> &out_pairs) override;
+
+private:
+  static bool choose_sweep_x(const std::vector<BroadphaseProxy> &proxies);
+};
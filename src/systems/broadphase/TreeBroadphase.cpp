@@ -0,0 +1,91 @@
+#include "TreeBroadphase.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace {
+  Rectangle merge(const Rectangle &a, const Rectangle &b) {
+    const float min_x = std::min(a.x, b.x);
+    const float min_y = std::min(a.y, b.y);
+    const float max_x = std::max(a.x + a.width, b.x + b.width);
+    const float max_y = std::max(a.y + a.height, b.y + b.height);
+    return Rectangle{min_x, min_y, max_x - min_x, max_y - min_y};
+  }
+}
+
+std::int32_t TreeBroadphase::build_node(const std::vector<BroadphaseProxy> &proxies, const std::uint32_t first,
+                                        const std::uint32_t count) {
+  const auto node_index = static_cast<std::int32_t>(nodes_.size());
+  nodes_.emplace_back();
+
+  Rectangle bounds = proxies[items_[first]].bounds;
+  for (std::uint32_t i = first + 1; i < first + count; ++i) {
+    bounds = merge(bounds, proxies[items_[i]].bounds);
+  }
+
+  if (count <= LEAF_SIZE) {
+    nodes_[node_index].bounds = bounds;
+    nodes_[node_index].first = first;
+    nodes_[node_index].count = count;
+    return node_index;
+  }
+
+  const bool split_x = bounds.width >= bounds.height;
+  const auto center = [&proxies, split_x](const std::uint32_t i) {
+    const Rectangle &b = proxies[i].bounds;
+    return split_x ? b.x + b.width * 0.5f : b.y + b.height * 0.5f;
+  };
+
+  const std::uint32_t half = count / 2;
+  const auto begin = items_.begin() + first;
+  std::nth_element(begin, begin + half, begin + count, [&center](const std::uint32_t a, const std::uint32_t b) {
+    return center(a) < center(b);
+  });
+
+  // nodes_ може реалокуватись під час рекурсії, тому пишемо через індекс
+  const std::int32_t left = build_node(proxies, first, half);
+  const std::int32_t right = build_node(proxies, first + half, count - half);
+  nodes_[node_index].bounds = bounds;
+  nodes_[node_index].left = left;
+  nodes_[node_index].right = right;
+  return node_index;
+}
+
+void TreeBroadphase::build_pairs(const std::vector<BroadphaseProxy> &proxies, std::vector<BroadphasePair> &out_pairs) {
+  nodes_.clear();
+  if (proxies.size() < 2) {
+    return;
+  }
+
+  items_.resize(proxies.size());
+  std::iota(items_.begin(), items_.end(), 0u);
+  build_node(proxies, 0, static_cast<std::uint32_t>(proxies.size()));
+
+  for (std::uint32_t i = 0; i < proxies.size(); ++i) {
+    const BroadphaseProxy &proxy = proxies[i];
+
+    stack_.clear();
+    stack_.push_back(0);
+    while (!stack_.empty()) {
+      const Node &node = nodes_[stack_.back()];
+      stack_.pop_back();
+
+      if (!overlaps(node.bounds, proxy.bounds)) {
+        continue;
+      }
+
+      if (!node.is_leaf()) {
+        stack_.push_back(node.left);
+        stack_.push_back(node.right);
+        continue;
+      }
+
+      for (std::uint32_t k = node.first; k < node.first + node.count; ++k) {
+        // Кожна пара звітується один раз — з боку меншого індексу
+        if (const std::uint32_t other = items_[k]; other > i && accepts(proxy, proxies[other])) {
+          out_pairs.push_back({proxy.index, proxies[other].index});
+        }
+      }
+    }
+  }
+}
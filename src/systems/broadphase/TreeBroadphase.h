@@ -0,0 +1,31 @@
+#pragma once
+#include "Broadphase.h"
+
+class TreeBroadphase final : public Broadphase {
+private:
+  static constexpr std::uint32_t LEAF_SIZE = 4;
+
+  struct Node {
+    Rectangle bounds;
+    std::int32_t left = -1;
+    std::int32_t right = -1;
+    std::uint32_t first = 0;
+    std::uint32_t count = 0;
+
+    bool is_leaf() const { return left < 0; }
+  };
+
+  // BVH перебудовується щокадру зверху вниз по медіані довшої осі
+  std::vector<Node> nodes_;
+  std::vector<std::uint32_t> items_;
+  std::vector<std::int32_t> stack_;
+
+public:
+  BroadphaseType get_type() const override { return BroadphaseType::TREE; }
+
+protected:
+  void build_pairs(const std::vector<BroadphaseProxy> &proxies, std::vector<BroadphasePair> &out_pairs) override;
+
+private:
+  std::int32_t build_node(const std::vector<BroadphaseProxy> &proxies, std::uint32_t first, std::uint32_t count);
+};
@@ -0,0 +1,67 @@
+#include "NullRenderBackend.h"
+
+#include <cstdio>
+#include <cstring>
+
+#include "utils.h"
+
+NullRenderBackend::~NullRenderBackend() {
+  if (!report_path_.empty()) {
+    close_window();
+  }
+}
+
+void NullRenderBackend::init_window(const int width, const int height, const char *title) {
+  screen_width_ = width;
+  screen_height_ = height;
+  TRACELOG(LOG_INFO, "NullRenderBackend: headless %dx%d \"%s\", %llu frames", width, height, title,
+           static_cast<unsigned long long>(frame_limit_));
+}
+
+void NullRenderBackend::close_window() {
+  if (report_path_.empty()) {
+    return;
+  }
+
+  if (write_reports(report_path_)) {
+    TRACELOG(LOG_INFO, "NullRenderBackend: %zu frame reports written to %s", reports_.size(), report_path_.c_str());
+  } else {
+    TRACELOG(LOG_WARNING, "NullRenderBackend: failed to write frame reports to %s", report_path_.c_str());
+  }
+  report_path_.clear();
+}
+
+bool NullRenderBackend::write_reports(const std::string &path) const {
+  FILE *file = std::fopen(path.c_str(), "w");
+  if (!file) {
+    return false;
+  }
+
+  std::fprintf(file, "frame,draw_calls,vertices,texture_binds,batch_flushes\n");
+  for (const RenderFrameReport &report : reports_) {
+    std::fprintf(file, "%llu,%zu,%zu,%zu,%zu\n", static_cast<unsigned long long>(report.frame),
+                 report.draw_calls, report.vertices, report.texture_binds, report.batch_flushes);
+  }
+  return std::fclose(file) == 0;
+}
+
+int NullRenderBackend::measure_text(const char *text, const int font_size) const {
+  return static_cast<int>(std::strlen(text)) * font_size / 2;
+}
+
+Texture2D NullRenderBackend::load_texture(const Image &image) {
+  return Texture2D{next_id_++, image.width, image.height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+}
+
+RenderTexture2D NullRenderBackend::load_render_texture(const int width, const int height) {
+  const unsigned int id = next_id_++;
+  return RenderTexture2D{
+    id,
+    Texture2D{next_id_++, width, height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8},
+    Texture2D{0, width, height, 1, 0}
+  };
+}
+
+Shader NullRenderBackend::load_shader(const char *) {
+  return Shader{next_id_++, nullptr};
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include <string>
+#include <vector>
+
+#include "RenderBackend.h"
+
+// Бекенд без вікна і GPU: нічого не малює, лише накопичує звіти кадрів.
+// Текстури й шейдери отримують фіктивні id, щоб код вище поводився як з реальними
+class NullRenderBackend final : public RenderBackend {
+public:
+  static constexpr std::uint64_t DEFAULT_FRAME_LIMIT = 600;
+  static constexpr float FIXED_FRAME_TIME = 1.f / 60.f;
+
+private:
+  std::vector<RenderFrameReport> reports_;
+  std::string report_path_;
+  std::uint64_t frame_limit_ = DEFAULT_FRAME_LIMIT;
+  unsigned int next_id_ = 1;
+  int target_fps_ = 60;
+  int screen_width_ = 0;
+  int screen_height_ = 0;
+
+public:
+  ~NullRenderBackend() override;
+
+  RenderBackendType get_type() const override { return RenderBackendType::NULL_BACKEND; }
+
+  // Після стількох кадрів should_close() повертає true
+  void set_frame_limit(std::uint64_t frame_limit) { frame_limit_ = frame_limit; }
+  // Куди close_window() запише CSV зі звітами; порожній шлях — не писати
+  void set_report_path(std::string path) { report_path_ = std::move(path); }
+
+  const std::vector<RenderFrameReport>& get_reports() const { return reports_; }
+  void clear_reports() { reports_.clear(); }
+  bool write_reports(const std::string &path) const;
+
+  void init_window(int width, int height, const char *title) override;
+  void close_window() override;
+  bool should_close() const override { return last_report_.frame >= frame_limit_; }
+  void set_target_fps(int fps) override { target_fps_ = fps; }
+  // Фіксований крок: без вікна raylib повертає нульовий час кадру, і симуляція б стояла
+  float get_frame_time() const override { return FIXED_FRAME_TIME; }
+  int get_fps() const override { return target_fps_; }
+  // Вікна немає, тож GetScreenWidth() дав би нуль і відсічення викинуло б усю сцену
+  int get_screen_width() const override { return screen_width_; }
+  int get_screen_height() const override { return screen_height_; }
+  // Наближення шрифту за замовчуванням: пів розміру на символ
+  int measure_text(const char *text, int font_size) const override;
+  Font get_font() const override { return Font{}; }
+
+  Texture2D load_texture(const Image &image) override;
+  void update_texture(const Texture2D &, const void *) override {}
+  void update_texture_rec(const Texture2D &, Rectangle, const void *) override {}
+  void set_texture_filter(const Texture2D &, int) override {}
+  void unload_texture(const Texture2D &) override {}
+  RenderTexture2D load_render_texture(int width, int height) override;
+  void unload_render_texture(const RenderTexture2D &) override {}
+  Shader load_shader(const char *fragment_source) override;
+  void unload_shader(const Shader &) override {}
+
+protected:
+  void submit_begin_frame(Color) override {}
+  void submit_end_frame() override {}
+  void submit_clear(Color) override {}
+  void submit_begin_mode_2d(const Camera2D &) override {}
+  void submit_end_mode_2d() override {}
+  void submit_begin_texture_mode(const RenderTexture2D &) override {}
+  void submit_end_texture_mode() override {}
+
+  void submit_texture(const Texture2D &, Rectangle, Rectangle, Vector2, float, Color) override {}
+  void submit_rect(Rectangle, Color) override {}
+  void submit_rect_lines(Rectangle, Color) override {}
+  void submit_rect_lines_ex(Rectangle, float, Color) override {}
+  void submit_circle(Vector2, float, Color) override {}
+  void submit_circle_lines(Vector2, float, Color) override {}
+  void submit_line(Vector2, Vector2, Color) override {}
+  void submit_text(const char *, int, int, int, Color) override {}
+  void submit_glyphs(const GlyphQuad *, size_t) override {}
+
+  void submit_begin_quads(const Shader &) override {}
+  void submit_quad(Rectangle, float, Color) override {}
+  void submit_end_quads() override {}
+
+  void on_frame_report(const RenderFrameReport &report) override { reports_.push_back(report); }
+};
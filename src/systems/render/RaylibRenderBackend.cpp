@@ -0,0 +1,235 @@
+#include "RaylibRenderBackend.h"
+
+#include "rlgl.h"
+
+namespace {
+
+// Метрики DrawText/MeasureText: розмір не менший за базовий 10, інтервал — розмір / 10
+constexpr int DEFAULT_FONT_SIZE = 10;
+
+float get_text_size(const int font_size) {
+  return static_cast<float>(font_size < DEFAULT_FONT_SIZE ? DEFAULT_FONT_SIZE : font_size);
+}
+
+float get_text_spacing(const float size) {
+  return static_cast<float>(static_cast<int>(size) / DEFAULT_FONT_SIZE);
+}
+
+} // namespace
+
+void RaylibRenderBackend::init_window(const int width, const int height, const char *title) {
+  InitWindow(width, height, title);
+}
+
+void RaylibRenderBackend::close_window() {
+  CloseWindow();
+}
+
+bool RaylibRenderBackend::should_close() const {
+  return WindowShouldClose();
+}
+
+void RaylibRenderBackend::set_target_fps(const int fps) {
+  SetTargetFPS(fps);
+}
+
+float RaylibRenderBackend::get_frame_time() const {
+  return GetFrameTime();
+}
+
+int RaylibRenderBackend::get_fps() const {
+  return GetFPS();
+}
+
+int RaylibRenderBackend::get_screen_width() const {
+  return GetScreenWidth();
+}
+
+int RaylibRenderBackend::get_screen_height() const {
+  return GetScreenHeight();
+}
+
+int RaylibRenderBackend::measure_text(const char *text, const int font_size) const {
+  const float size = get_text_size(font_size);
+  return static_cast<int>(MeasureTextEx(get_font(), text, size, get_text_spacing(size)).x);
+}
+
+Font RaylibRenderBackend::get_font() const {
+  return font_.texture.id != 0 ? font_ : GetFontDefault();
+}
+
+Texture2D RaylibRenderBackend::load_texture(const Image &image) {
+  return LoadTextureFromImage(image);
+}
+
+void RaylibRenderBackend::update_texture(const Texture2D &texture, const void *pixels) {
+  UpdateTexture(texture, pixels);
+}
+
+void RaylibRenderBackend::update_texture_rec(const Texture2D &texture, const Rectangle rect, const void *pixels) {
+  UpdateTextureRec(texture, rect, pixels);
+}
+
+void RaylibRenderBackend::set_texture_filter(const Texture2D &texture, const int filter) {
+  SetTextureFilter(texture, filter);
+}
+
+void RaylibRenderBackend::unload_texture(const Texture2D &texture) {
+  UnloadTexture(texture);
+}
+
+RenderTexture2D RaylibRenderBackend::load_render_texture(const int width, const int height) {
+  return LoadRenderTexture(width, height);
+}
+
+void RaylibRenderBackend::unload_render_texture(const RenderTexture2D &target) {
+  UnloadRenderTexture(target);
+}
+
+Shader RaylibRenderBackend::load_shader(const char *fragment_source) {
+  // nullptr для вершинного шейдера — береться стандартний raylib (fragTexCoord, fragColor)
+  const Shader shader = LoadShaderFromMemory(nullptr, fragment_source);
+
+  // При помилці компіляції raylib тихо повертає стандартний шейдер
+  if (!IsShaderValid(shader) || shader.id == rlGetShaderIdDefault()) {
+    return Shader{0, nullptr};
+  }
+  return shader;
+}
+
+void RaylibRenderBackend::unload_shader(const Shader &shader) {
+  if (shader.id != 0) {
+    UnloadShader(shader);
+  }
+}
+
+void RaylibRenderBackend::submit_begin_frame(const Color clear_color) {
+  BeginDrawing();
+  ClearBackground(clear_color);
+}
+
+void RaylibRenderBackend::submit_end_frame() {
+  EndDrawing();
+}
+
+void RaylibRenderBackend::submit_clear(const Color color) {
+  ClearBackground(color);
+}
+
+void RaylibRenderBackend::submit_begin_mode_2d(const Camera2D &camera) {
+  BeginMode2D(camera);
+}
+
+void RaylibRenderBackend::submit_end_mode_2d() {
+  EndMode2D();
+}
+
+void RaylibRenderBackend::submit_begin_texture_mode(const RenderTexture2D &target) {
+  BeginTextureMode(target);
+}
+
+void RaylibRenderBackend::submit_end_texture_mode() {
+  EndTextureMode();
+}
+
+void RaylibRenderBackend::submit_texture(const Texture2D &texture, const Rectangle source, const Rectangle dest,
+                                         const Vector2 origin, const float rotation, const Color tint) {
+  DrawTexturePro(texture, source, dest, origin, rotation, tint);
+}
+
+void RaylibRenderBackend::submit_rect(const Rectangle rect, const Color color) {
+  DrawRectangleRec(rect, color);
+}
+
+void RaylibRenderBackend::submit_rect_lines(const Rectangle rect, const Color color) {
+  DrawRectangleLines(static_cast<int>(rect.x), static_cast<int>(rect.y),
+                     static_cast<int>(rect.width), static_cast<int>(rect.height), color);
+}
+
+void RaylibRenderBackend::submit_rect_lines_ex(const Rectangle rect, const float thickness, const Color color) {
+  DrawRectangleLinesEx(rect, thickness, color);
+}
+
+void RaylibRenderBackend::submit_circle(const Vector2 center, const float radius, const Color color) {
+  DrawCircleV(center, radius, color);
+}
+
+void RaylibRenderBackend::submit_circle_lines(const Vector2 center, const float radius, const Color color) {
+  DrawCircleLinesV(center, radius, color);
+}
+
+void RaylibRenderBackend::submit_line(const Vector2 start, const Vector2 end, const Color color) {
+  DrawLineV(start, end, color);
+}
+
+void RaylibRenderBackend::submit_text(const char *text, const int x, const int y, const int font_size, const Color color) {
+  // Як DrawText, але з поточним шрифтом замість вбудованого
+  const float size = get_text_size(font_size);
+  DrawTextEx(get_font(), text, Vector2{static_cast<float>(x), static_cast<float>(y)}, size, get_text_spacing(size), color);
+}
+
+void RaylibRenderBackend::submit_glyphs(const GlyphQuad *quads, const size_t count) {
+  const Texture2D texture = get_font().texture;
+  const auto width = static_cast<float>(texture.width);
+  const auto height = static_cast<float>(texture.height);
+
+  for (size_t i = 0; i < count; ++i) {
+    const auto [source, dest, color] = quads[i];
+
+    // Як у DrawTexturePro: після переповнення rlgl скидає текстуру пакета, тож ставимо її знову
+    rlCheckRenderBatchLimit(4);
+    rlSetTexture(texture.id);
+
+    rlBegin(RL_QUADS);
+    rlColor4ub(color.r, color.g, color.b, color.a);
+    rlNormal3f(0.f, 0.f, 1.f);
+
+    rlTexCoord2f(source.x / width, source.y / height);
+    rlVertex2f(dest.x, dest.y);
+
+    rlTexCoord2f(source.x / width, (source.y + source.height) / height);
+    rlVertex2f(dest.x, dest.y + dest.height);
+
+    rlTexCoord2f((source.x + source.width) / width, (source.y + source.height) / height);
+    rlVertex2f(dest.x + dest.width, dest.y + dest.height);
+
+    rlTexCoord2f((source.x + source.width) / width, source.y / height);
+    rlVertex2f(dest.x + dest.width, dest.y);
+    rlEnd();
+  }
+
+  rlSetTexture(0);
+}
+
+void RaylibRenderBackend::submit_begin_quads(const Shader &shader) {
+  BeginShaderMode(shader);
+  rlSetTexture(rlGetTextureIdDefault());
+}
+
+void RaylibRenderBackend::submit_quad(const Rectangle quad, const float uv, const Color color) {
+  // Переповнений буфер rlgl скидається тут же
+  rlCheckRenderBatchLimit(4);
+
+  const auto [x, y, width, height] = quad;
+
+  rlBegin(RL_QUADS);
+  rlColor4ub(color.r, color.g, color.b, color.a);
+
+  rlTexCoord2f(-uv, -uv);
+  rlVertex2f(x, y);
+
+  rlTexCoord2f(-uv, uv);
+  rlVertex2f(x, y + height);
+
+  rlTexCoord2f(uv, uv);
+  rlVertex2f(x + width, y + height);
+
+  rlTexCoord2f(uv, -uv);
+  rlVertex2f(x + width, y);
+  rlEnd();
+}
+
+void RaylibRenderBackend::submit_end_quads() {
+  rlSetTexture(0);
+  EndShaderMode();
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include "RenderBackend.h"
+
+class RaylibRenderBackend final : public RenderBackend {
+public:
+  RenderBackendType get_type() const override { return RenderBackendType::RAYLIB; }
+
+  void init_window(int width, int height, const char *title) override;
+  void close_window() override;
+  bool should_close() const override;
+  void set_target_fps(int fps) override;
+  float get_frame_time() const override;
+  int get_fps() const override;
+  int get_screen_width() const override;
+  int get_screen_height() const override;
+  int measure_text(const char *text, int font_size) const override;
+  Font get_font() const override;
+
+  Texture2D load_texture(const Image &image) override;
+  void update_texture(const Texture2D &texture, const void *pixels) override;
+  void update_texture_rec(const Texture2D &texture, Rectangle rect, const void *pixels) override;
+  void set_texture_filter(const Texture2D &texture, int filter) override;
+  void unload_texture(const Texture2D &texture) override;
+  RenderTexture2D load_render_texture(int width, int height) override;
+  void unload_render_texture(const RenderTexture2D &target) override;
+  Shader load_shader(const char *fragment_source) override;
+  void unload_shader(const Shader &shader) override;
+
+protected:
+  void submit_begin_frame(Color clear_color) override;
+  void submit_end_frame() override;
+  void submit_clear(Color color) override;
+  void submit_begin_mode_2d(const Camera2D &camera) override;
+  void submit_end_mode_2d() override;
+  void submit_begin_texture_mode(const RenderTexture2D &target) override;
+  void submit_end_texture_mode() override;
+
+  void submit_texture(const Texture2D &texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) override;
+  void submit_rect(Rectangle rect, Color color) override;
+  void submit_rect_lines(Rectangle rect, Color color) override;
+  void submit_rect_lines_ex(Rectangle rect, float thickness, Color color) override;
+  void submit_circle(Vector2 center, float radius, Color color) override;
+  void submit_circle_lines(Vector2 center, float radius, Color color) override;
+  void submit_line(Vector2 start, Vector2 end, Color color) override;
+  void submit_text(const char *text, int x, int y, int font_size, Color color) override;
+  void submit_glyphs(const GlyphQuad *quads, size_t count) override;
+
+  void submit_begin_quads(const Shader &shader) override;
+  void submit_quad(Rectangle quad, float uv, Color color) override;
+  void submit_end_quads() override;
+};
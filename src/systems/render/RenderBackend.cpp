@@ -0,0 +1,250 @@
+#include "RenderBackend.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#include "NullRenderBackend.h"
+#include "RaylibRenderBackend.h"
+
+namespace {
+
+std::unique_ptr<RenderBackend> current_backend;
+
+} // namespace
+
+const char *to_string(const RenderBackendType type) {
+  switch (type) {
+    case RenderBackendType::RAYLIB:
+      return "Raylib";
+    case RenderBackendType::NULL_BACKEND:
+      return "Null";
+    default:
+      return "Unknown";
+  }
+}
+
+RenderBackend &RenderBackend::get() {
+  if (!current_backend) {
+    current_backend = create(RenderBackendType::RAYLIB);
+  }
+  return *current_backend;
+}
+
+void RenderBackend::set(std::unique_ptr<RenderBackend> backend) {
+  current_backend = std::move(backend);
+}
+
+std::unique_ptr<RenderBackend> RenderBackend::create(const RenderBackendType type) {
+  switch (type) {
+    case RenderBackendType::NULL_BACKEND:
+      return std::make_unique<NullRenderBackend>();
+    case RenderBackendType::RAYLIB:
+    default:
+      return std::make_unique<RaylibRenderBackend>();
+  }
+}
+
+void RenderBackend::init_from_args(const int argc, char **argv) {
+  bool headless = false;
+  long frame_limit = NullRenderBackend::DEFAULT_FRAME_LIMIT;
+  const char *report_path = nullptr;
+
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--headless") == 0) {
+      headless = true;
+    } else if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+      frame_limit = std::strtol(argv[++i], nullptr, 10);
+    } else if (std::strcmp(argv[i], "--report") == 0 && i + 1 < argc) {
+      report_path = argv[++i];
+    }
+  }
+
+  if (!headless) {
+    set(create(RenderBackendType::RAYLIB));
+    return;
+  }
+
+  auto backend = std::make_unique<NullRenderBackend>();
+  backend->set_frame_limit(frame_limit > 0 ? static_cast<std::uint64_t>(frame_limit) : NullRenderBackend::DEFAULT_FRAME_LIMIT);
+  if (report_path) {
+    backend->set_report_path(report_path);
+  }
+  set(std::move(backend));
+}
+
+void RenderBackend::begin_frame(const Color clear_color) {
+  report_ = RenderFrameReport{};
+  report_.frame = last_report_.frame + 1;
+  bound_texture_ = 0;
+  bound_shader_ = 0;
+  pending_vertices_ = 0;
+  submit_begin_frame(clear_color);
+}
+
+void RenderBackend::end_frame() {
+  flush_batch();
+  submit_end_frame();
+
+  last_report_ = report_;
+  on_frame_report(last_report_);
+}
+
+void RenderBackend::clear(const Color color) {
+  submit_clear(color);
+}
+
+void RenderBackend::begin_mode_2d(const Camera2D &camera) {
+  flush_batch();
+  submit_begin_mode_2d(camera);
+}
+
+void RenderBackend::end_mode_2d() {
+  flush_batch();
+  submit_end_mode_2d();
+}
+
+void RenderBackend::begin_texture_mode(const RenderTexture2D &target) {
+  flush_batch();
+  submit_begin_texture_mode(target);
+}
+
+void RenderBackend::end_texture_mode() {
+  flush_batch();
+  submit_end_texture_mode();
+}
+
+void RenderBackend::draw_texture(const Texture2D &texture, const Rectangle source, const Rectangle dest,
+                                 const Vector2 origin, const float rotation, const Color tint) {
+  bind_texture(texture.id);
+  add_vertices(4);
+  ++report_.draw_calls;
+  submit_texture(texture, source, dest, origin, rotation, tint);
+}
+
+void RenderBackend::draw_rect(const Rectangle rect, const Color color) {
+  bind_texture(SHAPES_TEXTURE_ID);
+  add_vertices(4);
+  ++report_.draw_calls;
+  submit_rect(rect, color);
+}
+
+void RenderBackend::draw_rect_lines(const Rectangle rect, const Color color) {
+  // Чотири лінії по дві вершини
+  bind_texture(SHAPES_TEXTURE_ID);
+  add_vertices(8);
+  ++report_.draw_calls;
+  submit_rect_lines(rect, color);
+}
+
+void RenderBackend::draw_rect_lines_ex(const Rectangle rect, const float thickness, const Color color) {
+  // Товста рамка — чотири прямокутники
+  bind_texture(SHAPES_TEXTURE_ID);
+  add_vertices(16);
+  ++report_.draw_calls;
+  submit_rect_lines_ex(rect, thickness, color);
+}
+
+void RenderBackend::draw_circle(const Vector2 center, const float radius, const Color color) {
+  // raylib малює сектор квадами — по кваду на два сегменти
+  bind_texture(SHAPES_TEXTURE_ID);
+  add_vertices(CIRCLE_SEGMENTS / 2 * 4);
+  ++report_.draw_calls;
+  submit_circle(center, radius, color);
+}
+
+void RenderBackend::draw_circle_lines(const Vector2 center, const float radius, const Color color) {
+  bind_texture(SHAPES_TEXTURE_ID);
+  add_vertices(CIRCLE_SEGMENTS * 2);
+  ++report_.draw_calls;
+  submit_circle_lines(center, radius, color);
+}
+
+void RenderBackend::draw_line(const Vector2 start, const Vector2 end, const Color color) {
+  bind_texture(SHAPES_TEXTURE_ID);
+  add_vertices(2);
+  ++report_.draw_calls;
+  submit_line(start, end, color);
+}
+
+void RenderBackend::draw_text(const char *text, const int x, const int y, const int font_size, const Color color) {
+  bind_texture(get_font_texture_id());
+  add_vertices(count_glyphs(text) * 4);
+  ++report_.draw_calls;
+  submit_text(text, x, y, font_size, color);
+}
+
+void RenderBackend::draw_glyphs(const GlyphQuad *quads, const size_t count) {
+  if (count == 0) {
+    return;
+  }
+  bind_texture(get_font_texture_id());
+  add_vertices(count * 4);
+  ++report_.draw_calls;
+  submit_glyphs(quads, count);
+}
+
+void RenderBackend::begin_quads(const Shader &shader) {
+  bind_shader(shader.id);
+  bind_texture(DEFAULT_TEXTURE_ID);
+  ++report_.draw_calls;
+  submit_begin_quads(shader);
+}
+
+void RenderBackend::draw_quad(const Rectangle quad, const float uv, const Color color) {
+  add_vertices(4);
+  submit_quad(quad, uv, color);
+}
+
+void RenderBackend::end_quads() {
+  submit_end_quads();
+  bind_shader(0);
+}
+
+void RenderBackend::bind_texture(const std::uint32_t texture_id) {
+  if (bound_texture_ == texture_id) {
+    return;
+  }
+  flush_batch();
+  bound_texture_ = texture_id;
+  ++report_.texture_binds;
+}
+
+void RenderBackend::bind_shader(const unsigned int shader_id) {
+  if (bound_shader_ == shader_id) {
+    return;
+  }
+  flush_batch();
+  bound_shader_ = shader_id;
+}
+
+void RenderBackend::add_vertices(const size_t count) {
+  if (pending_vertices_ + count > BATCH_VERTEX_LIMIT) {
+    flush_batch();
+  }
+  pending_vertices_ += count;
+  report_.vertices += count;
+}
+
+void RenderBackend::flush_batch() {
+  if (pending_vertices_ == 0) {
+    return;
+  }
+  pending_vertices_ = 0;
+  ++report_.batch_flushes;
+}
+
+std::uint32_t RenderBackend::get_font_texture_id() const {
+  return font_.texture.id != 0 ? font_.texture.id : SHAPES_TEXTURE_ID;
+}
+
+size_t RenderBackend::count_glyphs(const char *text) {
+  // Пробіли й переноси не дають квадів; байти-продовження UTF-8 не рахуємо
+  size_t glyphs = 0;
+  for (const char *c = text; *c != '\0'; ++c) {
+    const auto byte = static_cast<unsigned char>(*c);
+    if ((byte & 0xC0) != 0x80 && byte != ' ' && byte != '\n') {
+      ++glyphs;
+    }
+  }
+  return glyphs;
+}
@@ -0,0 +1,157 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "raylib.h"
+
+// Що подано на відмальовку за кадр. Рахується однаково для всіх бекендів,
+// тож звіт null-бекенда на агенті без GPU збігається з тим, що пішло б у raylib
+struct RenderFrameReport {
+  std::uint64_t frame = 0;
+  size_t draw_calls = 0;
+  size_t vertices = 0;
+  // Зміни прив'язаної текстури між сусідніми викликами
+  size_t texture_binds = 0;
+  // Скидання пакета rlgl: зміна текстури, шейдера, режиму камери, переповнення буфера, кінець кадру
+  size_t batch_flushes = 0;
+};
+
+// Готовий квад гліфа поточного шрифту: source — у пікселях текстури шрифту, dest — на екрані
+struct GlyphQuad {
+  Rectangle source;
+  Rectangle dest;
+  Color color;
+};
+
+enum class RenderBackendType {
+  RAYLIB,
+  NULL_BACKEND
+};
+
+const char *to_string(RenderBackendType type);
+
+// Усі виклики малювання і GPU-ресурсів проходять тут. Публічні draw_* рахують звіт кадру
+// і делегують віртуальним submit_*; ресурси й вікно реалізує бекенд напряму
+class RenderBackend {
+public:
+  // Як у raylib: 8192 квади в буфері пакета, коло — 36 сегментів
+  static constexpr size_t BATCH_VERTEX_LIMIT = 8192 * 4;
+  static constexpr size_t CIRCLE_SEGMENTS = 36;
+
+  // Фігури і шрифт за замовчуванням у raylib ділять одну текстуру, SDF-квади — білу текстуру rlgl
+  static constexpr std::uint32_t SHAPES_TEXTURE_ID = 0xFFFFFFFE;
+  static constexpr std::uint32_t DEFAULT_TEXTURE_ID = 0xFFFFFFFD;
+
+protected:
+  RenderFrameReport report_;
+  RenderFrameReport last_report_;
+  std::uint32_t bound_texture_ = 0;
+  unsigned int bound_shader_ = 0;
+  size_t pending_vertices_ = 0;
+  // Шрифт тексту; texture.id == 0 — вбудований шрифт бекенда
+  Font font_{};
+
+public:
+  virtual ~RenderBackend() = default;
+
+  virtual RenderBackendType get_type() const = 0;
+
+  // Поточний бекенд; без явного set() — raylib
+  static RenderBackend& get();
+  static void set(std::unique_ptr<RenderBackend> backend);
+  static std::unique_ptr<RenderBackend> create(RenderBackendType type);
+  // --headless вмикає null-бекенд; --frames N обмежує кількість кадрів, --report PATH пише CSV зі звітами
+  static void init_from_args(int argc, char **argv);
+
+  // Вікно і таймінг
+  virtual void init_window(int width, int height, const char *title) = 0;
+  virtual void close_window() = 0;
+  virtual bool should_close() const = 0;
+  virtual void set_target_fps(int fps) = 0;
+  virtual float get_frame_time() const = 0;
+  virtual int get_fps() const = 0;
+  // Розмір області відмальовки в пікселях; без вікна — той, що переданий в init_window
+  virtual int get_screen_width() const = 0;
+  virtual int get_screen_height() const = 0;
+
+  // Кадр і режими
+  void begin_frame(Color clear_color);
+  void end_frame();
+  void clear(Color color);
+  void begin_mode_2d(const Camera2D &camera);
+  void end_mode_2d();
+  void begin_texture_mode(const RenderTexture2D &target);
+  void end_texture_mode();
+
+  // Малювання
+  void draw_texture(const Texture2D &texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint);
+  void draw_rect(Rectangle rect, Color color);
+  void draw_rect_lines(Rectangle rect, Color color);
+  void draw_rect_lines_ex(Rectangle rect, float thickness, Color color);
+  void draw_circle(Vector2 center, float radius, Color color);
+  void draw_circle_lines(Vector2 center, float radius, Color color);
+  void draw_line(Vector2 start, Vector2 end, Color color);
+  void draw_text(const char *text, int x, int y, int font_size, Color color);
+  virtual int measure_text(const char *text, int font_size) const = 0;
+  // Метрики шрифту для розкладки тексту поза потоком рендера; без вікна glyphs == nullptr
+  virtual Font get_font() const = 0;
+  // Шрифт належить викликачу і має жити, доки встановлений; Font{} повертає вбудований
+  void set_font(const Font &font) { font_ = font; }
+  // Уже розкладені гліфи — один виклик і одна прив'язка текстури на весь масив
+  void draw_glyphs(const GlyphQuad *quads, size_t count);
+
+  // Пакет квадів з власним шейдером поверх білої текстури; uv задає половину сторони в текстурних координатах
+  void begin_quads(const Shader &shader);
+  void draw_quad(Rectangle quad, float uv, Color color);
+  void end_quads();
+
+  // Ресурси GPU
+  virtual Texture2D load_texture(const Image &image) = 0;
+  virtual void update_texture(const Texture2D &texture, const void *pixels) = 0;
+  virtual void update_texture_rec(const Texture2D &texture, Rectangle rect, const void *pixels) = 0;
+  virtual void set_texture_filter(const Texture2D &texture, int filter) = 0;
+  virtual void unload_texture(const Texture2D &texture) = 0;
+  virtual RenderTexture2D load_render_texture(int width, int height) = 0;
+  virtual void unload_render_texture(const RenderTexture2D &target) = 0;
+  // Повертає шейдер з id 0, якщо компіляція не вдалася або шейдери не підтримуються
+  virtual Shader load_shader(const char *fragment_source) = 0;
+  virtual void unload_shader(const Shader &shader) = 0;
+
+  const RenderFrameReport& get_report() const { return report_; }
+  const RenderFrameReport& get_last_report() const { return last_report_; }
+
+protected:
+  virtual void submit_begin_frame(Color clear_color) = 0;
+  virtual void submit_end_frame() = 0;
+  virtual void submit_clear(Color color) = 0;
+  virtual void submit_begin_mode_2d(const Camera2D &camera) = 0;
+  virtual void submit_end_mode_2d() = 0;
+  virtual void submit_begin_texture_mode(const RenderTexture2D &target) = 0;
+  virtual void submit_end_texture_mode() = 0;
+
+  virtual void submit_texture(const Texture2D &texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) = 0;
+  virtual void submit_rect(Rectangle rect, Color color) = 0;
+  virtual void submit_rect_lines(Rectangle rect, Color color) = 0;
+  virtual void submit_rect_lines_ex(Rectangle rect, float thickness, Color color) = 0;
+  virtual void submit_circle(Vector2 center, float radius, Color color) = 0;
+  virtual void submit_circle_lines(Vector2 center, float radius, Color color) = 0;
+  virtual void submit_line(Vector2 start, Vector2 end, Color color) = 0;
+  virtual void submit_text(const char *text, int x, int y, int font_size, Color color) = 0;
+  virtual void submit_glyphs(const GlyphQuad *quads, size_t count) = 0;
+
+  virtual void submit_begin_quads(const Shader &shader) = 0;
+  virtual void submit_quad(Rectangle quad, float uv, Color color) = 0;
+  virtual void submit_end_quads() = 0;
+
+  // Викликається з end_frame() із заповненим звітом
+  virtual void on_frame_report(const RenderFrameReport &) {}
+
+private:
+  void bind_texture(std::uint32_t texture_id);
+  void bind_shader(unsigned int shader_id);
+  void add_vertices(size_t count);
+  void flush_batch();
+  std::uint32_t get_font_texture_id() const;
+  static size_t count_glyphs(const char *text);
+};
@@ -2,18 +2,24 @@
 #include "core/EntityManager.h"
 #include "components/Transform.h"
 #include "components/Sprite.h"
+#include "systems/AssetLoader.h"
 #include "systems/TransformSystem.h"
 #include "systems/RenderSystem.h"
+#include "systems/render/RenderBackend.h"
+#include <filesystem>
 #include <iostream>
 
-int main() {
+int main(int argc, char **argv) {
     std::cout << "🎮 Starting ECS Test with EntityManager..." << std::endl;
 
     // Ініціалізація Raylib
     constexpr int screenWidth = 800;
     constexpr int screenHeight = 600;
-    InitWindow(screenWidth, screenHeight, "ECS Test - With EntityManager");
-    SetTargetFPS(60);
+    // --headless: без вікна, з покадровим звітом відмальовки (див. RenderBackend::init_from_args)
+    RenderBackend::init_from_args(argc, argv);
+    RenderBackend &backend = RenderBackend::get();
+    backend.init_window(screenWidth, screenHeight, "ECS Test - With EntityManager");
+    backend.set_target_fps(60);
 
     // ❗ НОВИЙ ПІДХІД: EntityManager керує всіма entities
     EntityManager entity_manager;
@@ -21,6 +27,15 @@ int main() {
     // Створюємо системи
     TransformSystem transform_system;
     RenderSystem render_system;
+    AssetLoader asset_loader;
+
+    // ❗ Текстура демо пишеться на диск і вантажиться у фоні: цикл крутиться, поки файл декодується,
+    // а спрайт до завантаження малюється заглушкою
+    const std::string crate_path = (std::filesystem::temp_directory_path() / "bulbyk_crate.png").string();
+    const Image crate_image = GenImageChecked(64, 64, 8, 8, BROWN, BEIGE);
+    ExportImage(crate_image, crate_path.c_str());
+    UnloadImage(crate_image);
+    const TextureRequest crate_texture = asset_loader.load_texture_async("crate", crate_path);
 
     // ❗ Створюємо entities через manager (без unique_ptr!)
     Entity* player = entity_manager.create_entity();
@@ -39,6 +54,10 @@ int main() {
     enemy3->add_component<Components::Transform>(Vector2{100, 500});
     enemy3->add_component<Components::Sprite>(12.0f, ORANGE);
 
+    Entity* crate = entity_manager.create_entity();
+    crate->add_component<Components::Transform>(Vector2{700, 500});
+    crate->add_component<Components::Sprite>(crate_texture.handle);
+
     Entity* background = entity_manager.create_entity();
     background->add_component<Components::Transform>(Vector2{screenWidth/2.0f, screenHeight/2.0f});
     auto* bg_sprite = background->add_component<Components::Sprite>(50.0f, DARKGREEN);
@@ -79,15 +98,24 @@ int main() {
     // ❗ Змінні для тесту знищення entity
     float destroy_timer = 5.0f;  // Через 5 секунд знищимо enemy1
     bool enemy1_destroyed = false;
+    bool atlas_enabled = true;
+    // --headless: кадри, у яких відсічення не лишило жодного спрайта — сцена ж уся в межах екрана
+    const bool headless = backend.get_type() == RenderBackendType::NULL_BACKEND;
+    size_t empty_frames = 0;
 
     // ❗ ГОЛОВНИЙ ІГРОВИЙ ЦИКЛ
-    while (!WindowShouldClose()) {
-        float delta_time = GetFrameTime();
+    while (!backend.should_close()) {
+        float delta_time = backend.get_frame_time();
 
         // ============================================
         // INPUT PHASE
         // ============================================
 
+        if (IsKeyPressed(KEY_T)) {
+            atlas_enabled = !atlas_enabled;
+            render_system.set_atlas_enabled(atlas_enabled);
+        }
+
         // Тест знищення entity
         if (!enemy1_destroyed) {
             destroy_timer -= delta_time;
@@ -104,6 +132,9 @@ int main() {
             }
         }
 
+        // Декодовані у фоні зображення потрапляють на GPU лише з головного потоку
+        asset_loader.pump(render_system);
+
         // ============================================
         // UPDATE PHASE
         // ============================================
@@ -122,34 +153,50 @@ int main() {
         // RENDER PHASE
         // ============================================
 
-        BeginDrawing();
-            ClearBackground(Color{34, 139, 34, 255});
+        backend.begin_frame(Color{34, 139, 34, 255});
 
             render_system.render();
 
             // UI
-            DrawText("🎮 ECS Test with EntityManager", 10, 10, 20, WHITE);
-            DrawText(TextFormat("FPS: %d", GetFPS()), 10, 35, 20, WHITE);
-            DrawText(TextFormat("Entities: %zu", entity_manager.get_entity_count()), 10, 60, 20, WHITE);
+            backend.draw_text("🎮 ECS Test with EntityManager", 10, 10, 20, WHITE);
+            backend.draw_text(TextFormat("FPS: %d", backend.get_fps()), 10, 35, 20, WHITE);
+            backend.draw_text(TextFormat("Entities: %zu", entity_manager.get_entity_count()), 10, 60, 20, WHITE);
 
             // Таймер знищення
             if (!enemy1_destroyed) {
-                DrawText(TextFormat("Enemy1 will be destroyed in: %.1fs", destroy_timer),
+                backend.draw_text(TextFormat("Enemy1 will be destroyed in: %.1fs", destroy_timer),
                         10, 90, 16, YELLOW);
             } else {
-                DrawText("Enemy1 destroyed! (red circle disappeared)", 10, 90, 16, RED);
+                backend.draw_text("Enemy1 destroyed! (red circle disappeared)", 10, 90, 16, RED);
             }
 
             Vector2 player_pos = TransformSystem::get_position(player);
-            DrawText(TextFormat("Player: (%.0f, %.0f)", player_pos.x, player_pos.y),
+            backend.draw_text(TextFormat("Player: (%.0f, %.0f)", player_pos.x, player_pos.y),
                     10, 120, 16, SKYBLUE);
 
+            const RenderStats& stats = render_system.get_stats();
+            empty_frames += stats.visible == 0;
+            backend.draw_text(TextFormat("Atlas %s: %zu draws, %zu batch flushes",
+                                atlas_enabled ? "ON" : "OFF", stats.draw_calls, stats.batch_flushes),
+                    10, 145, 16, SKYBLUE);
+
+            // Звіт попереднього кадру — поточний ще збирається
+            const RenderFrameReport& report = backend.get_last_report();
+            backend.draw_text(TextFormat("%s: %zu draws, %zu verts, %zu binds",
+                                to_string(backend.get_type()), report.draw_calls, report.vertices, report.texture_binds),
+                    10, 165, 16, SKYBLUE);
+
+            const LoadProgress progress = asset_loader.get_progress();
+            backend.draw_text(TextFormat("Assets: %zu/%zu uploaded, %zu failed",
+                                progress.uploaded, progress.requested, progress.failed),
+                    10, 185, 16, SKYBLUE);
+
             // Інструкції
-            DrawText("Entities move and bounce automatically", 10, screenHeight - 60, 16, LIGHTGRAY);
-            DrawText("Watch as enemy1 disappears after 5 seconds!", 10, screenHeight - 40, 16, LIGHTGRAY);
-            DrawText("ESC - Exit", 10, screenHeight - 20, 16, LIGHTGRAY);
+            backend.draw_text("Entities move and bounce automatically", 10, screenHeight - 60, 16, LIGHTGRAY);
+            backend.draw_text("Watch as enemy1 disappears after 5 seconds!", 10, screenHeight - 40, 16, LIGHTGRAY);
+            backend.draw_text("T - Toggle texture atlas, ESC - Exit", 10, screenHeight - 20, 16, LIGHTGRAY);
 
-        EndDrawing();
+        backend.end_frame();
     }
 
     // Очищення
@@ -158,7 +205,12 @@ int main() {
     render_system.clear_entities();
     entity_manager.clear();
 
-    CloseWindow();
+    backend.close_window();
+
+    if (headless && empty_frames > 0) {
+        std::cout << "❌ " << empty_frames << " headless frames culled every sprite" << std::endl;
+        return 1;
+    }
 
     std::cout << "👋 ECS Test completed!" << std::endl;
     return 0;
@@ -9,18 +9,22 @@
 #include "components/Collider.h"
 #include "systems/TransformSystem.h"
 #include "systems/RenderSystem.h"
+#include "systems/render/RenderBackend.h"
 #include "systems/CollisionSystem.h"
 #include <iostream>
 
 using namespace Components;
 
-int main() {
+int main(int argc, char **argv) {
     std::cout << "🎮 Testing CollisionSystem..." << std::endl;
 
     const int screenWidth = 800;
     const int screenHeight = 600;
-    InitWindow(screenWidth, screenHeight, "CollisionSystem Test");
-    SetTargetFPS(60);
+    // --headless: без вікна, з покадровим звітом відмальовки (див. RenderBackend::init_from_args)
+    RenderBackend::init_from_args(argc, argv);
+    RenderBackend &backend = RenderBackend::get();
+    backend.init_window(screenWidth, screenHeight, "CollisionSystem Test");
+    backend.set_target_fps(60);
 
     // Створюємо менеджер і системи
     EntityManager entity_manager;
@@ -89,6 +93,30 @@ int main() {
     wall_collider->mask = CollisionLayer::PLAYER | CollisionLayer::ENEMY;
     wall_collider->debug_color = DARKGRAY;
 
+    // ❗ Повернута стіна (OBB) — враховує Transform::rotation
+    Entity *rotated_wall = entity_manager.create_entity();
+    rotated_wall->add_component<Components::Transform>(Vector2{150, 450}, 30.0f);
+    auto *rotated_wall_collider = rotated_wall->add_component<Collider>(
+        Vector2{120, 30},
+        CollisionLayer::OBSTACLE,
+        false
+    );
+    rotated_wall_collider->type = ColliderType::ORIENTED_BOX;
+    rotated_wall_collider->mask = CollisionLayer::PLAYER | CollisionLayer::ENEMY;
+    rotated_wall_collider->debug_color = DARKGRAY;
+
+    // ❗ Колода (капсула)
+    Entity *log = entity_manager.create_entity();
+    log->add_component<Components::Transform>(Vector2{550, 520}, -15.0f);
+    auto *log_collider = log->add_component<Collider>(
+        12.0f, // radius
+        50.0f, // half_length
+        CollisionLayer::OBSTACLE,
+        false
+    );
+    log_collider->mask = CollisionLayer::PLAYER | CollisionLayer::ENEMY;
+    log_collider->debug_color = BROWN;
+
     // Реєструємо в системах
     for (Entity *e: entity_manager.get_entities_with<Components::Transform>()) {
         transform_system.register_entity(e);
@@ -156,8 +184,8 @@ int main() {
     bool show_debug_colliders = true;
 
     // Головний цикл
-    while (!WindowShouldClose()) {
-        float dt = GetFrameTime();
+    while (!backend.should_close()) {
+        float dt = backend.get_frame_time();
 
         // ============================================
         // INPUT
@@ -205,8 +233,7 @@ int main() {
         // RENDER
         // ============================================
 
-        BeginDrawing();
-        ClearBackground(Color{34, 139, 34, 255});
+        backend.begin_frame(Color{34, 139, 34, 255});
 
         render_system.render();
 
@@ -216,27 +243,28 @@ int main() {
         }
 
         // UI
-        DrawText("🎮 CollisionSystem Test", 10, 10, 20, WHITE);
-        DrawText("WASD - Move Player", 10, 35, 16, WHITE);
-        DrawText("SPACE - Toggle Debug Colliders", 10, 55, 16, WHITE);
+        backend.draw_text("🎮 CollisionSystem Test", 10, 10, 20, WHITE);
+        backend.draw_text("WASD - Move Player", 10, 35, 16, WHITE);
+        backend.draw_text("SPACE - Toggle Debug Colliders", 10, 55, 16, WHITE);
 
-        DrawText(TextFormat("Collisions this frame: %d", collision_count), 10, 85, 16, YELLOW);
+        backend.draw_text(TextFormat("Collisions this frame: %d", collision_count), 10, 85, 16, YELLOW);
 
         if (player_in_pickup) {
-            DrawText("💰 IN PICKUP ZONE!", 10, 110, 20, GOLD);
+            backend.draw_text("💰 IN PICKUP ZONE!", 10, 110, 20, GOLD);
         }
 
-        DrawText(TextFormat("FPS: %d", GetFPS()), 10, 140, 16, WHITE);
+        backend.draw_text(TextFormat("FPS: %d", backend.get_fps()), 10, 140, 16, WHITE);
 
         // Легенда
-        DrawText("Blue = Player", 10, screenHeight - 90, 14, SKYBLUE);
-        DrawText("Red = Enemies", 10, screenHeight - 70, 14, PINK);
-        DrawText("Gold = Pickup (trigger)", 10, screenHeight - 50, 14, YELLOW);
-        DrawText("Gray = Wall", 10, screenHeight - 30, 14, DARKGRAY);
+        backend.draw_text("Blue = Player", 10, screenHeight - 90, 14, SKYBLUE);
+        backend.draw_text("Red = Enemies", 10, screenHeight - 70, 14, PINK);
+        backend.draw_text("Gold = Pickup (trigger)", 10, screenHeight - 50, 14, YELLOW);
+        backend.draw_text("Gray = Walls (AABB + OBB)", 10, screenHeight - 30, 14, DARKGRAY);
+        backend.draw_text("Brown = Log (capsule)", 10, screenHeight - 110, 14, BROWN);
 
-        EndDrawing();
+        backend.end_frame();
     }
 
-    CloseWindow();
+    backend.close_window();
     return 0;
 }
@@ -0,0 +1,840 @@
+// Перевірки пакетних ядер без вікна: кожна порівнює швидкий шлях з еталонним.
+// Код повернення ненульовий, якщо хоч одна розійшлася, — ціль запускається через ctest
+
+#include "EnemyFactory.h"
+#include "EnemySystem.h"
+#include "components/Chaser.h"
+#include "core/EntityManager.h"
+#include "core/EntityPool.h"
+#include "core/Steering.h"
+#include "core/ThreadPool.h"
+#include "systems/CollisionSystem.h"
+#include "systems/CrowdSeparation.h"
+#include "systems/FlowField.h"
+#include "systems/Narrowphase.h"
+#include "systems/TransformSystem.h"
+#include "systems/broadphase/Broadphase.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct Agents {
+    std::vector<float> position_x, position_y, velocity_x, velocity_y, speed, target_x, target_y, step_time;
+
+    Agents(const size_t count, const unsigned seed) {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<float> coord(-600.f, 600.f);
+        std::uniform_real_distribution<float> speeds(40.f, 400.f);
+        std::uniform_real_distribution<float> step_times(0.f, 0.5f);
+        for (size_t i = 0; i < count; ++i) {
+            position_x.push_back(coord(gen));
+            position_y.push_back(coord(gen));
+            target_x.push_back(coord(gen));
+            target_y.push_back(coord(gen));
+            speed.push_back(speeds(gen));
+            step_time.push_back(step_times(gen));
+        }
+        velocity_x.assign(count, 0.f);
+        velocity_y.assign(count, 0.f);
+
+        // Крайні випадки: агент точно в цілі, агент у межах stop_radius
+        if (count > 2) {
+            position_x[1] = 0.f;
+            position_y[1] = 0.f;
+            target_x[1] = 0.f;
+            target_y[1] = 0.f;
+            position_x[2] = 5.f;
+            position_y[2] = 0.f;
+        }
+    }
+
+    Steering::ChaseBatch view(const bool per_agent_targets, const bool per_agent_time = false) {
+        Steering::ChaseBatch batch = {position_x.data(), position_y.data(), velocity_x.data(), velocity_y.data(),
+                                      speed.data(), position_x.size()};
+        if (per_agent_targets) {
+            batch.target_x = target_x.data();
+            batch.target_y = target_y.data();
+        }
+        if (per_agent_time) {
+            batch.delta_time = step_time.data();
+        }
+        return batch;
+    }
+
+    bool same_bits(const Agents &other) const {
+        const size_t bytes = position_x.size() * sizeof(float);
+        return std::memcmp(position_x.data(), other.position_x.data(), bytes) == 0 &&
+               std::memcmp(position_y.data(), other.position_y.data(), bytes) == 0 &&
+               std::memcmp(velocity_x.data(), other.velocity_x.data(), bytes) == 0 &&
+               std::memcmp(velocity_y.data(), other.velocity_y.data(), bytes) == 0;
+    }
+};
+
+int failures = 0;
+
+void report(const char *name, const bool passed) {
+    std::cout << (passed ? "  ✅ " : "  ❌ ") << name << std::endl;
+    if (!passed) {
+        ++failures;
+    }
+}
+
+void check_steering_parity() {
+    std::cout << "🧭 Steering (SIMD " << (Steering::is_simd_enabled() ? "on" : "off") << ")" << std::endl;
+
+    // Розміри з хвостами 0..3 і великим dt, за якого крок обрізається на stop_radius;
+    // останній прохід — з власним кроком часу кожного агента, як у проріджених рівнях EnemySystem
+    bool chase_identical = true;
+    bool steer_identical = true;
+    for (const size_t count : {1u, 3u, 4u, 7u, 64u, 1001u}) {
+        for (const bool per_agent : {false, true}) {
+            for (const float delta_time : {1.f / 60.f, 4.f / 60.f, 2.f, -1.f}) {
+                const bool per_agent_time = delta_time < 0.f;
+                Agents fast(count, static_cast<unsigned>(count));
+                Agents reference(count, static_cast<unsigned>(count));
+                for (int frame = 0; frame < 30; ++frame) {
+                    Steering::chase(fast.view(per_agent, per_agent_time), {10.f, -20.f}, 15.f, delta_time);
+                    Steering::chase_scalar(reference.view(per_agent, per_agent_time), {10.f, -20.f}, 15.f, delta_time);
+                }
+                chase_identical = chase_identical && fast.same_bits(reference);
+
+                Steering::steer(fast.view(per_agent), {-300.f, 250.f}, 15.f);
+                Steering::steer_scalar(reference.view(per_agent), {-300.f, 250.f}, 15.f);
+                steer_identical = steer_identical && fast.same_bits(reference);
+            }
+        }
+    }
+    report("chase matches chase_scalar bit for bit", chase_identical);
+    report("steer matches steer_scalar bit for bit", steer_identical);
+
+    // Великий крок зупиняється рівно на stop_radius, а не перестрибує ціль
+    Agents agents(64, 7);
+    constexpr Vector2 target = {0.f, 0.f};
+    constexpr float stop_radius = 15.f;
+    bool no_overshoot = true;
+    for (int frame = 0; frame < 20; ++frame) {
+        Steering::chase(agents.view(false), target, stop_radius, 0.5f);
+        for (size_t i = 0; i < agents.position_x.size(); ++i) {
+            const float distance = std::hypot(agents.position_x[i], agents.position_y[i]);
+            no_overshoot = no_overshoot && (distance >= stop_radius - 0.01f || i == 1 || i == 2);
+        }
+    }
+    report("large steps clamp to stop_radius", no_overshoot);
+
+    // Лише для довідки: час не перевіряється, бо залежить від машини
+    const auto time_us = [](const auto &kernel) {
+        Agents crowd(4096, 11);
+        const auto start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < 200; ++frame) {
+            kernel(crowd.view(false));
+        }
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / 200.0;
+    };
+    const double fast_us = time_us([](const Steering::ChaseBatch &batch) {
+        Steering::chase(batch, {0.f, 0.f}, 15.f, 1.f / 60.f);
+    });
+    const double scalar_us = time_us([](const Steering::ChaseBatch &batch) {
+        Steering::chase_scalar(batch, {0.f, 0.f}, 15.f, 1.f / 60.f);
+    });
+    std::cout << "  ⏱  4096 agents: chase " << fast_us << " us, chase_scalar " << scalar_us << " us" << std::endl;
+}
+
+// Однакові відстані й напрямки в кожній клітинці
+bool same_field(const FlowField &field, const FlowField &reference) {
+    const float cell = field.get_cell_size();
+    for (int y = 0; y < field.get_rows(); ++y) {
+        for (int x = 0; x < field.get_columns(); ++x) {
+            const Vector2 center = {(static_cast<float>(x) + 0.5f) * cell, (static_cast<float>(y) + 0.5f) * cell};
+            const Vector2 a = field.sample(center);
+            const Vector2 b = reference.sample(center);
+            if (field.get_distance(center) != reference.get_distance(center) || a.x != b.x || a.y != b.y) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void check_flow_field() {
+    std::cout << "🗺  FlowField" << std::endl;
+
+    constexpr Rectangle bounds = {0.f, 0.f, 2048.f, 1536.f};
+    constexpr float cell = 32.f;
+    constexpr Vector2 target = {1000.f, 700.f};
+
+    FlowField field(bounds, cell);
+    field.update(target);
+    report("no obstacles: field is not built", !field.is_built() && field.get_stats().full_rebuilds == 0);
+
+    // Випадкові стіни ставляться й знімаються інкрементно; після кожної зміни поле має збігатися
+    // з повністю перебудованим з нуля для того ж набору перешкод
+    std::mt19937 gen(3);
+    std::uniform_real_distribution<float> x_dist(0.f, bounds.width);
+    std::uniform_real_distribution<float> y_dist(0.f, bounds.height);
+    std::vector<Vector2> walls;
+    bool incremental_matches = true;
+    for (int step = 0; step < 300; ++step) {
+        if (walls.empty() || gen() % 3 != 0) {
+            walls.push_back({x_dist(gen), y_dist(gen)});
+            field.set_blocked(walls.back(), true);
+        } else {
+            const size_t index = gen() % walls.size();
+            field.set_blocked(walls[index], false);
+            walls.erase(walls.begin() + static_cast<std::ptrdiff_t>(index));
+            // Та сама клітинка могла бути під кількома стінами
+            for (const Vector2 &wall : walls) {
+                field.set_blocked(wall, true);
+            }
+        }
+
+        if (step % 10 == 0) {
+            FlowField reference(bounds, cell);
+            for (const Vector2 &wall : walls) {
+                reference.set_blocked(wall, true);
+            }
+            reference.update(target);
+            incremental_matches = incremental_matches && same_field(field, reference);
+        }
+    }
+    report("incremental set_blocked matches a full rebuild", incremental_matches);
+    report("only the first obstacle rebuilt the field", field.get_stats().full_rebuilds == 1);
+
+    // Пряма видимість: стіна поперек лінії закриває ціль, поза нею — ні
+    FlowField sight(bounds, cell);
+    sight.update(target);
+    for (float y = 500.f; y <= 900.f; y += cell) {
+        sight.set_blocked({800.f, y}, true);
+    }
+    report("line of sight is blocked behind a wall", !sight.has_line_of_sight({600.f, 700.f}));
+    report("line of sight is clear beside a wall", sight.has_line_of_sight({1200.f, 700.f}));
+    const Vector2 around = sight.sample({600.f, 700.f});
+    report("blocked agents get a direction around the wall", around.x != 0.f || around.y != 0.f);
+}
+
+// Щільний рій навколо однієї точки з кількома агентами точно в ній
+std::vector<Vector2> make_crowd(const size_t count, const unsigned seed) {
+    std::mt19937 gen(seed);
+    std::normal_distribution<float> spread(0.f, 150.f);
+    std::vector<Vector2> positions(count);
+    for (size_t i = 0; i < count; ++i) {
+        positions[i] = i % 50 == 0 ? Vector2{1024.f, 768.f} : Vector2{1024.f + spread(gen), 768.f + spread(gen)};
+    }
+    return positions;
+}
+
+// Кілька кадрів розштовхування; позиції після кожного кадру стають знімком наступного
+std::vector<Vector2> separate(std::vector<Vector2> positions, ThreadPool *pool, const size_t parallel_threshold,
+                              const int frames, double *frame_us = nullptr) {
+    CrowdSeparation::Settings settings;
+    settings.parallel_threshold = parallel_threshold;
+    CrowdSeparation separation({0.f, 0.f, 2048.f, 1536.f}, settings);
+    separation.set_thread_pool(pool);
+    separation.reserve(positions.size());
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+        separation.begin();
+        for (size_t i = 0; i < positions.size(); ++i) {
+            separation.add(positions[i], 8.f + static_cast<float>(i % 5) * 2.5f);
+        }
+        separation.solve(1.f / 60.f);
+        for (size_t i = 0; i < positions.size(); ++i) {
+            positions[i] = separation.get_position(i);
+        }
+    }
+    if (frame_us) {
+        *frame_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / frames;
+    }
+    return positions;
+}
+
+void check_crowd_separation() {
+    std::cout << "🐞 CrowdSeparation" << std::endl;
+
+    // Паралельний шлях примусово (поріг 0) проти послідовного на тих самих знімках,
+    // включно з натовпами, меншими за кількість діапазонів
+    ThreadPool pool(3);
+    bool identical = true;
+    for (const size_t count : {1u, 3u, 5u, 200u, 1000u, 5000u}) {
+        const std::vector<Vector2> crowd = make_crowd(count, static_cast<unsigned>(count));
+        const std::vector<Vector2> serial = separate(crowd, nullptr, 0, 10);
+        const std::vector<Vector2> parallel = separate(crowd, &pool, 0, 10);
+        identical = identical && std::memcmp(serial.data(), parallel.data(), count * sizeof(Vector2)) == 0;
+    }
+    report("parallel solve matches serial solve bit for bit", identical);
+
+    // Розштовхування справді розводить купу
+    const std::vector<Vector2> crowd = make_crowd(500, 5);
+    const std::vector<Vector2> spread = separate(crowd, nullptr, 0, 120);
+    const auto overlaps = [](const std::vector<Vector2> &positions) {
+        size_t count = 0;
+        for (size_t i = 0; i < positions.size(); ++i) {
+            for (size_t j = i + 1; j < positions.size(); ++j) {
+                count += std::hypot(positions[i].x - positions[j].x, positions[i].y - positions[j].y) < 8.f;
+            }
+        }
+        return count;
+    };
+    report("crowd spreads out", overlaps(spread) * 4 < overlaps(crowd));
+
+    // Заміри для parallel_threshold: послідовно проти поділу на пул
+    for (const size_t count : {256u, 512u, 2048u, 5000u}) {
+        double serial_us = 0.0;
+        double parallel_us = 0.0;
+        separate(make_crowd(count, 9), nullptr, 0, 60, &serial_us);
+        separate(make_crowd(count, 9), &pool, 0, 60, &parallel_us);
+        std::cout << "  ⏱  " << count << " agents: serial " << serial_us << " us, " << pool.get_thread_count() + 1
+                  << " ranges " << parallel_us << " us" << std::endl;
+    }
+}
+
+// Випадкова сцена для широкої фази: дрібні й oversized proxies (понад 64 клітинки сітки), спільні кути,
+// межі точно на лініях сітки, дотик ребрами і від'ємні координати. index навмисно не збігається з позицією
+std::vector<BroadphaseProxy> make_scene(const size_t count, std::mt19937 &gen, const float cell) {
+    std::uniform_real_distribution<float> coord(-300.f, 1500.f);
+    std::uniform_real_distribution<float> size(2.f, 60.f);
+    std::uniform_real_distribution<float> large(cell * 9.f, cell * 14.f);
+    std::vector<BroadphaseProxy> proxies;
+    for (size_t i = 0; i < count; ++i) {
+        BroadphaseProxy proxy = {{coord(gen), coord(gen), size(gen), size(gen)},
+                                 static_cast<std::uint32_t>(i * 3 + 7), gen() % 5 < 2};
+        switch (gen() % 8) {
+            case 0:
+                proxy.bounds.width = large(gen);
+                proxy.bounds.height = large(gen);
+                break;
+            case 1:
+                if (!proxies.empty()) {
+                    const Rectangle &other = proxies[gen() % proxies.size()].bounds;
+                    proxy.bounds.x = other.x;
+                    proxy.bounds.y = other.y;
+                }
+                break;
+            case 2:
+                proxy.bounds.x = std::floor(proxy.bounds.x / cell) * cell;
+                proxy.bounds.y = std::floor(proxy.bounds.y / cell) * cell;
+                break;
+            case 3:
+                if (!proxies.empty()) {
+                    const Rectangle &other = proxies[gen() % proxies.size()].bounds;
+                    proxy.bounds.x = other.x + other.width;
+                    proxy.bounds.y = other.y;
+                }
+                break;
+            default:
+                break;
+        }
+        proxies.push_back(proxy);
+    }
+    return proxies;
+}
+
+// Пари без урахування порядку всередині пари і в списку
+std::vector<std::pair<std::uint32_t, std::uint32_t>> normalized(const std::vector<BroadphasePair> &pairs) {
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> out;
+    out.reserve(pairs.size());
+    for (const BroadphasePair &pair : pairs) {
+        out.emplace_back(std::min(pair.a, pair.b), std::max(pair.a, pair.b));
+    }
+    std::ranges::sort(out);
+    return out;
+}
+
+void check_broadphase() {
+    std::cout << "📦 Broadphase" << std::endl;
+
+    constexpr float cell = 32.f;
+    constexpr BroadphaseType accelerated[] = {BroadphaseType::GRID, BroadphaseType::SWEEP_AND_PRUNE, BroadphaseType::TREE};
+
+    // Ті самі об'єкти між сценами: SweepAndPrune тримає порядок з попереднього кадру
+    const std::unique_ptr<Broadphase> reference = Broadphase::create(BroadphaseType::ALL_PAIRS, cell);
+    std::vector<std::unique_ptr<Broadphase>> strategies;
+    for (const BroadphaseType type : accelerated) {
+        strategies.push_back(Broadphase::create(type, cell));
+    }
+
+    std::mt19937 gen(23);
+    std::vector<BroadphasePair> expected_pairs;
+    std::vector<BroadphasePair> pairs;
+    bool same_pairs[std::size(accelerated)] = {true, true, true};
+    bool stats_match = true;
+    bool no_sleeping_pairs = true;
+    size_t max_pairs = 0;
+    for (const size_t count : {0u, 1u, 2u, 17u, 150u, 600u, 1500u}) {
+        std::vector<BroadphaseProxy> proxies = make_scene(count, gen, cell);
+        std::unordered_map<std::uint32_t, bool> sleeping;
+        for (const BroadphaseProxy &proxy : proxies) {
+            sleeping[proxy.index] = proxy.sleeping;
+        }
+
+        // Кілька кадрів з невеликим зсувом — порядок SweepAndPrune встигає застаріти
+        std::uniform_real_distribution<float> jitter(-6.f, 6.f);
+        for (int frame = 0; frame < 3; ++frame) {
+            for (BroadphaseProxy &proxy : proxies) {
+                proxy.bounds.x += jitter(gen);
+                proxy.bounds.y += jitter(gen);
+            }
+
+            reference->find_pairs(proxies, expected_pairs);
+            const auto expected = normalized(expected_pairs);
+            max_pairs = std::max(max_pairs, expected.size());
+            for (const auto &[a, b] : expected) {
+                no_sleeping_pairs = no_sleeping_pairs && !(sleeping[a] && sleeping[b]);
+            }
+
+            for (size_t s = 0; s < strategies.size(); ++s) {
+                Broadphase &strategy = *strategies[s];
+                strategy.find_pairs(proxies, pairs);
+                same_pairs[s] = same_pairs[s] && normalized(pairs) == expected;
+
+                // Кандидати — рівно повернуті пари; влучання скидаються новим кадром і беруться з вузької фази
+                const BroadphaseStats &stats = strategy.get_stats();
+                stats_match = stats_match && stats.proxy_count == proxies.size() &&
+                              stats.candidate_pairs == pairs.size() && stats.true_hits == 0;
+                strategy.report_true_hits(pairs.size() / 2);
+                stats_match = stats_match && strategy.get_stats().true_hits == pairs.size() / 2;
+            }
+        }
+    }
+
+    std::cout << "  up to " << max_pairs << " pairs per scene" << std::endl;
+    report("AllPairs never pairs two sleeping proxies", no_sleeping_pairs);
+    for (size_t s = 0; s < strategies.size(); ++s) {
+        const std::string name = std::string(to_string(accelerated[s])) + " matches AllPairs pair for pair";
+        report(name.c_str(), same_pairs[s]);
+    }
+    report("candidate and hit stats follow the returned pairs", stats_match);
+}
+
+Narrowphase::Shape make_box(const Vector2 center, const Vector2 size, const float degrees) {
+    Components::Collider collider(size, Components::CollisionLayer::NONE);
+    collider.type = Components::ColliderType::ORIENTED_BOX;
+    return Narrowphase::make_shape(Components::Transform(center, degrees), collider);
+}
+
+Narrowphase::Shape make_capsule(const Vector2 center, const float radius, const float half_length, const float degrees) {
+    const Components::Collider collider(radius, half_length, Components::CollisionLayer::NONE);
+    return Narrowphase::make_shape(Components::Transform(center, degrees), collider);
+}
+
+bool close_to(const float value, const float expected) {
+    return std::abs(value - expected) < 1e-3f;
+}
+
+// Контакт є, а глибина й нормаль (від A до B) збігаються з порахованими вручну
+bool contact_is(const Narrowphase::Test test, const Narrowphase::Shape &a, const Narrowphase::Shape &b,
+                const float penetration, const Vector2 normal) {
+    Narrowphase::Contact contact{};
+    return test(a, b, &contact) && close_to(contact.penetration, penetration) &&
+           close_to(contact.normal.x, normal.x) && close_to(contact.normal.y, normal.y);
+}
+
+// Тести симетричних пар: поміняні аргументи дають ту саму глибину і протилежну нормаль
+bool symmetric_contact_is(const Narrowphase::Test test, const Narrowphase::Shape &a, const Narrowphase::Shape &b,
+                          const float penetration, const Vector2 normal) {
+    return contact_is(test, a, b, penetration, normal) && contact_is(test, b, a, penetration, {-normal.x, -normal.y});
+}
+
+void check_narrowphase() {
+    std::cout << "📐 Narrowphase" << std::endl;
+
+    const float sqrt2 = std::sqrt(2.f);
+    const float cos30 = std::cos(30.f * DEG2RAD);
+    const float sin30 = std::sin(30.f * DEG2RAD);
+    Narrowphase::Contact contact{};
+
+    // Ромб праворуч від квадрата: найменше перекриття — вздовж осі X квадрата
+    const Narrowphase::Shape square = make_box({0.f, 0.f}, {20.f, 20.f}, 0.f);
+    const Narrowphase::Shape diamond = make_box({15.f, 0.f}, {20.f, 20.f}, 45.f);
+    report("box_vs_box: rotated boxes", symmetric_contact_is(Narrowphase::box_vs_box, square, diamond, 10.f + 10.f * sqrt2 - 15.f, {1.f, 0.f}));
+
+    // Малий квадрат цілком усередині повернутого прямокутника виштовхується через найближчу грань
+    const Narrowphase::Shape outer = make_box({100.f, 50.f}, {100.f, 60.f}, 30.f);
+    const Vector2 inner_center = {100.f + 10.f * cos30 - 4.f * sin30, 50.f + 10.f * sin30 + 4.f * cos30};
+    const Narrowphase::Shape inner = make_box(inner_center, {10.f, 10.f}, 0.f);
+    report("box_vs_box: box fully inside a rotated box",
+           symmetric_contact_is(Narrowphase::box_vs_box, outer, inner, 30.f + 5.f * (cos30 + sin30) - 4.f, {-sin30, cos30}));
+
+    report("box_vs_box: separated boxes don't touch",
+           !Narrowphase::box_vs_box(square, make_box({30.f, 0.f}, {20.f, 20.f}, 45.f), &contact));
+
+    // Паралельні капсули: відстань між відрізками 8, сума радіусів 10
+    const Narrowphase::Shape rod = make_capsule({0.f, 0.f}, 5.f, 20.f, 0.f);
+    report("capsule_vs_capsule: parallel capsules",
+           symmetric_contact_is(Narrowphase::capsule_vs_capsule, rod, make_capsule({10.f, 8.f}, 5.f, 20.f, 0.f), 2.f, {0.f, 1.f}));
+
+    // Схрещені відрізки: виштовхування вздовж X на 26 вирівнює вертикальну капсулу з кінцем горизонтальної
+    report("capsule_vs_capsule: crossing capsules",
+           symmetric_contact_is(Narrowphase::capsule_vs_capsule, rod, make_capsule({3.f, 2.f}, 4.f, 20.f, 90.f), 26.f, {1.f, 0.f}));
+
+    report("capsule_vs_capsule: separated capsules don't touch",
+           !Narrowphase::capsule_vs_capsule(rod, make_capsule({0.f, 11.f}, 5.f, 20.f, 0.f), &contact));
+
+    // Кінець капсули на діагоналі за кутом (10, 10), на відстані 3√2 від нього
+    const float half_length = 10.f;
+    const Vector2 tip_center = {13.f + half_length / sqrt2, 13.f + half_length / sqrt2};
+    report("box_vs_capsule: capsule end against a box corner",
+           contact_is(Narrowphase::box_vs_capsule, square, make_capsule(tip_center, 5.f, half_length, 45.f),
+                      5.f - 3.f * sqrt2, {1.f / sqrt2, 1.f / sqrt2}));
+
+    report("box_vs_capsule: capsule past the corner doesn't touch",
+           !Narrowphase::box_vs_capsule(square, make_capsule({15.f + half_length / sqrt2, 15.f + half_length / sqrt2}, 5.f, half_length, 45.f), &contact));
+
+    // Капсула зареєстрована першою, тож пара приходить як (капсула, коробка) і sort_pairs_by_shape її міняє
+    EntityManager manager;
+    Entity *capsule = manager.create_entity();
+    capsule->add_component<Components::Transform>(Vector2{0.f, 0.f}, 0.f);
+    capsule->add_component<Components::Collider>(5.f, 20.f, Components::CollisionLayer::NONE);
+    Entity *box = manager.create_entity();
+    box->add_component<Components::Transform>(Vector2{0.f, 9.f}, 0.f);
+    box->add_component<Components::Collider>(Vector2{20.f, 10.f}, Components::CollisionLayer::NONE)->type =
+        Components::ColliderType::ORIENTED_BOX;
+
+    CollisionSystem collision;
+    collision.register_entity(capsule);
+    collision.register_entity(box);
+    std::vector<CollisionInfo> contacts;
+    collision.add_collision_callback([&contacts](const CollisionInfo &info) { contacts.push_back(info); });
+
+    const auto points_from_a_to_b = [](const CollisionInfo &info) {
+        const Vector2 a = info.entity_a->get_component<Components::Transform>()->position;
+        const Vector2 b = info.entity_b->get_component<Components::Transform>()->position;
+        return info.collision_normal.x * (b.x - a.x) + info.collision_normal.y * (b.y - a.y) > 0.f;
+    };
+
+    CollisionInfo info{};
+    report("check_collision puts the lower shape type first and the normal points from A to B",
+           collision.check_collision(capsule, box, &info) && info.entity_a == box && info.entity_b == capsule &&
+           close_to(info.penetration_depth, 1.f) && points_from_a_to_b(info));
+
+    // Рухається лише капсула: розв'язок має відштовхнути її від коробки, а не втиснути глибше
+    capsule->get_component<Components::Transform>()->velocity = {0.f, 30.f};
+    collision.update();
+    const bool swapped = contacts.size() == 1 && contacts[0].entity_a == box && contacts[0].entity_b == capsule;
+    report("sort_pairs_by_shape swaps the pair and the normal points from A to B",
+           swapped && close_to(contacts[0].penetration_depth, 1.f) && points_from_a_to_b(contacts[0]));
+    report("resolving a swapped pair separates the bodies",
+           close_to(capsule->get_component<Components::Transform>()->position.y, -1.f) &&
+           (!collision.check_collision(box, capsule, &info) || close_to(info.penetration_depth, 0.f)));
+}
+
+Entity *make_body(EntityManager &manager, const Vector2 position) {
+    Entity *entity = manager.create_entity();
+    entity->add_component<Components::Transform>(position);
+    entity->add_component<Components::Collider>(10.f, Components::CollisionLayer::NONE);
+    return entity;
+}
+
+void check_sleep() {
+    std::cout << "💤 Sleep" << std::endl;
+
+    constexpr unsigned int sleep_frames = 5;
+    constexpr float delta_time = 1.f / 60.f;
+    constexpr size_t resting = 3;
+
+    EntityManager manager;
+    TransformSystem transforms;
+    transforms.set_sleep_frames(sleep_frames);
+    CollisionSystem collision;
+    size_t contacts = 0;
+    collision.add_collision_callback([&contacts](const CollisionInfo &) { ++contacts; });
+
+    // Три тіла стоять впритул одне до одного, четверте летить далеко від них
+    std::vector<Entity*> bodies = {
+        make_body(manager, {0.f, 0.f}), make_body(manager, {5.f, 0.f}), make_body(manager, {-5.f, 0.f}),
+        make_body(manager, {500.f, 0.f})
+    };
+    for (Entity *body : bodies) {
+        transforms.register_entity(body);
+        collision.register_entity(body);
+    }
+    TransformSystem::set_velocity(bodies[3], {60.f, 0.f});
+
+    const auto transform_of = [](const Entity *entity) { return entity->get_component<Components::Transform>(); };
+    const auto resting_asleep = [&] {
+        bool asleep = transforms.get_sleeping_count() == resting;
+        for (size_t i = 0; i < resting; ++i) {
+            asleep = asleep && transform_of(bodies[i])->sleeping;
+        }
+        return asleep;
+    };
+
+    bool awake_until_due = true;
+    for (unsigned int frame = 1; frame < sleep_frames; ++frame) {
+        transforms.update(delta_time);
+        awake_until_due = awake_until_due && transforms.get_sleeping_count() == 0;
+    }
+    transforms.update(delta_time);
+    report("bodies at rest fall asleep after exactly sleep_frames frames",
+           awake_until_due && resting_asleep() && transforms.get_awake_count() == 1 && !transform_of(bodies[3])->sleeping);
+
+    // Сплячих не обходять: лічильник спокою не росте, а рухоме тіло інтегрується далі
+    const float moving_x = transform_of(bodies[3])->position.x;
+    for (int frame = 0; frame < 10; ++frame) {
+        transforms.update(delta_time);
+    }
+    bool skipped = resting_asleep();
+    for (size_t i = 0; i < resting; ++i) {
+        skipped = skipped && transform_of(bodies[i])->rest_frames == sleep_frames;
+    }
+    report("sleeping bodies are not integrated", skipped && close_to(transform_of(bodies[3])->position.x, moving_x + 10.f));
+
+    bool no_sleeping_pairs = true;
+    for (const BroadphaseType type : {BroadphaseType::ALL_PAIRS, BroadphaseType::GRID, BroadphaseType::SWEEP_AND_PRUNE, BroadphaseType::TREE}) {
+        collision.set_broadphase(type);
+        collision.update();
+        no_sleeping_pairs = no_sleeping_pairs && contacts == 0 && collision.get_broadphase_stats().candidate_pairs == 0;
+    }
+    report("overlapping sleeping bodies never form a pair", no_sleeping_pairs && resting_asleep());
+
+    // Нульова швидкість не будить, решта змін — будять, і тіло інтегрується вже в тому ж update()
+    TransformSystem::set_velocity(bodies[0], {0.f, 0.f});
+    transforms.update(delta_time);
+    const bool zero_velocity_sleeps = resting_asleep();
+    TransformSystem::set_velocity(bodies[0], {0.f, 30.f});
+    TransformSystem::set_position(bodies[1], {5.f, 100.f});
+    TransformSystem::move(bodies[2], {-100.f, 0.f});
+    transforms.update(delta_time);
+    bool woke = zero_velocity_sleeps && transforms.get_sleeping_count() == 0 && close_to(transform_of(bodies[0])->position.y, 30.f * delta_time);
+    for (size_t i = 0; i < resting; ++i) {
+        woke = woke && !transform_of(bodies[i])->sleeping && transform_of(bodies[i])->rest_frames <= 1;
+    }
+    report("set_velocity, set_position and move wake a sleeping body", woke);
+
+    TransformSystem::set_velocity(bodies[0], {0.f, 0.f});
+    for (unsigned int frame = 0; frame < sleep_frames; ++frame) {
+        transforms.update(delta_time);
+    }
+    const bool asleep_again = resting_asleep();
+
+    // Активне тіло з'являється поверх сплячого: handle_contact будить лише його
+    Entity *visitor = make_body(manager, {0.f, 10.f});
+    transforms.register_entity(visitor);
+    collision.register_entity(visitor);
+    collision.update();
+    transforms.update(delta_time);
+    report("contact with an awake body wakes only the touched sleeper",
+           asleep_again && contacts == 1 && !transform_of(bodies[0])->sleeping && transform_of(bodies[1])->sleeping &&
+           transform_of(bodies[2])->sleeping && transforms.get_sleeping_count() == resting - 1);
+}
+
+// Пул на capacity слотів, що записує кожну звільнену сутність
+struct RecordingPool {
+    EntityPool pool;
+    std::vector<Entity*> released;
+
+    RecordingPool(EntityManager &manager, const PoolOverflowPolicy policy, const size_t capacity) : pool(policy) {
+        pool.init(manager, capacity, [](Entity *entity) { entity->add_component<Components::Transform>(); });
+        pool.set_release_callback([this](Entity *entity) { released.push_back(entity); });
+    }
+
+    std::vector<Entity*> fill() {
+        std::vector<Entity*> acquired;
+        while (!pool.is_full()) {
+            acquired.push_back(pool.acquire());
+        }
+        return acquired;
+    }
+};
+
+void check_entity_pool() {
+    std::cout << "♻️  EntityPool" << std::endl;
+
+    constexpr size_t capacity = 4;
+    EntityManager manager;
+
+    RecordingPool drop_new(manager, PoolOverflowPolicy::DROP_NEW, capacity);
+    const std::vector<Entity*> kept = drop_new.fill();
+    const bool dropped = drop_new.pool.acquire() == nullptr && drop_new.pool.acquire() == nullptr;
+    report("DROP_NEW returns nullptr and counts the overflow",
+           dropped && drop_new.pool.get_overflow_count() == 2 && drop_new.pool.get_active() == kept && drop_new.released.empty());
+
+    // Витіснений слот одразу видається знову і стає наймолодшим
+    RecordingPool drop_oldest(manager, PoolOverflowPolicy::DROP_OLDEST, capacity);
+    const std::vector<Entity*> first = drop_oldest.fill();
+    Entity *reused_first = drop_oldest.pool.acquire();
+    Entity *reused_second = drop_oldest.pool.acquire();
+    const std::vector<Entity*> rotated = {first[2], first[3], first[0], first[1]};
+    report("DROP_OLDEST evicts the front of the active list and calls the release callback",
+           reused_first == first[0] && reused_second == first[1] && drop_oldest.released == std::vector{first[0], first[1]} &&
+           drop_oldest.pool.get_active() == rotated && drop_oldest.pool.get_overflow_count() == 2);
+
+    RecordingPool recycle(manager, PoolOverflowPolicy::RECYCLE_FARTHEST, capacity);
+    const std::vector<Entity*> placed = recycle.fill();
+    const Vector2 positions[capacity] = {{110.f, 100.f}, {100.f, 150.f}, {70.f, 100.f}, {100.f, 80.f}};
+    for (size_t i = 0; i < capacity; ++i) {
+        placed[i]->get_component<Components::Transform>()->position = positions[i];
+    }
+    Entity *near_reference = recycle.pool.acquire({100.f, 100.f});
+    Entity *near_corner = recycle.pool.acquire({100.f, 150.f});
+    report("RECYCLE_FARTHEST evicts the entity farthest from the reference point",
+           near_reference == placed[1] && near_corner == placed[3] && recycle.released == std::vector{placed[1], placed[3]} &&
+           recycle.pool.get_overflow_count() == 2);
+
+    // user-045 покладається на те, що release_if не переставляє тих, хто лишився
+    RecordingPool sweep(manager, PoolOverflowPolicy::DROP_NEW, 2 * capacity);
+    const std::vector<Entity*> all = sweep.fill();
+    std::vector<Entity*> survivors;
+    std::vector<Entity*> expired;
+    for (size_t i = 0; i < all.size(); ++i) {
+        (i % 3 == 0 ? expired : survivors).push_back(all[i]);
+    }
+    const size_t swept = sweep.pool.release_if([&expired](const Entity *entity) {
+        return std::ranges::find(expired, entity) != expired.end();
+    });
+    const bool refilled = sweep.fill().size() == expired.size() && sweep.pool.get_overflow_count() == 0;
+    report("release_if releases the matches and keeps the survivors in order",
+           swept == expired.size() && sweep.released == expired &&
+           std::equal(survivors.begin(), survivors.end(), sweep.pool.get_active().begin()) && refilled);
+}
+
+// Облік одного агента з боку перевірки: коли з'явився, скільки часу прокрокував і в якому кадрі востаннє
+struct AgentClock {
+    double spawned = 0.0;
+    double stepped = 0.0;
+    int last_frame = 0;
+};
+
+// Групи суцільні й упорядковані, кожен агент стоїть у своїй групі й знає свій індекс
+bool groups_consistent(const EnemySystem::Batch &batch) {
+    if (batch.group.size() != batch.size() || batch.group_begin[0] != 0) {
+        return false;
+    }
+    for (size_t g = 0; g < EnemySystem::LOD_GROUP_COUNT; ++g) {
+        if (batch.group_begin[g] > batch.group_end(g)) {
+            return false;
+        }
+        for (size_t i = batch.group_begin[g]; i < batch.group_end(g); ++i) {
+            const Entity *entity = batch.entities[i];
+            if (batch.group[i] != g || entity->get_component<Components::Chaser>()->batch_index != i) {
+                return false;
+            }
+            // Кошик невидимого агента — за id, інакше зміна рівня зсунула б його чергу
+            if (g != EnemySystem::VISIBLE_GROUP &&
+                (g - 1) % EnemySystem::LOD_BUCKET_COUNT != entity->get_id() % EnemySystem::LOD_BUCKET_COUNT) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void check_enemy_lod() {
+    std::cout << "👾 EnemySystem LOD" << std::endl;
+
+    constexpr size_t count = 1500;
+    constexpr int frames = 600;
+    constexpr float world_width = GameConstants::WORLD_WIDTH;
+    constexpr float world_height = GameConstants::WORLD_HEIGHT;
+    constexpr double tolerance = 1e-3;
+
+    std::mt19937 gen(17);
+    std::uniform_real_distribution<float> x_dist(0.f, world_width);
+    std::uniform_real_distribution<float> y_dist(0.f, world_height);
+    std::uniform_real_distribution<float> frame_time(1.f / 120.f, 1.f / 20.f);
+    std::uniform_real_distribution<float> drift(-40.f, 40.f);
+    const auto random_type = [&gen] { return static_cast<EnemyType>(gen() % ENEMY_TYPE_COUNT); };
+
+    EntityManager manager;
+    EnemySystem system;
+    system.reserve(count);
+    std::vector<Entity*> active;
+    std::vector<Entity*> retired;
+    std::unordered_map<const Entity*, AgentClock> clocks;
+    double clock = 0.0;
+    int frame = 0;
+
+    const auto spawn = [&](Entity *entity) {
+        system.register_entity(entity);
+        active.push_back(entity);
+        clocks[entity] = {clock, 0.0, frame};
+    };
+    for (size_t i = 0; i < count; ++i) {
+        spawn(EnemyFactory::create_enemy_entity(manager, random_type(), {x_dist(gen), y_dist(gen)}));
+    }
+
+    Vector2 target = {world_width / 2.f, world_height / 2.f};
+    bool consistent = true;
+    bool time_conserved = true;
+    bool on_schedule = true;
+    for (frame = 1; frame <= frames; ++frame) {
+        // Камера блукає і зрідка стрибає, тож агенти постійно переходять між рівнями
+        if (gen() % 50 == 0) {
+            target = {x_dist(gen), y_dist(gen)};
+        } else {
+            target = {std::clamp(target.x + drift(gen), 0.f, world_width), std::clamp(target.y + drift(gen), 0.f, world_height)};
+        }
+        const Rectangle view = {target.x - 400.f, target.y - 300.f, 800.f, 600.f};
+
+        const float delta_time = frame_time(gen);
+        clock += delta_time;
+        system.update(delta_time, target, view);
+
+        for (size_t type = 0; type < ENEMY_TYPE_COUNT; ++type) {
+            const EnemySystem::Batch &batch = system.get_batch(static_cast<EnemyType>(type));
+            consistent = consistent && groups_consistent(batch);
+            for (size_t i = 0; i < batch.size(); ++i) {
+                AgentClock &agent = clocks[batch.entities[i]];
+                if (batch.last_step[i] == clock) {
+                    agent.stepped += batch.step_time[i];
+                    agent.last_frame = frame;
+                }
+                // Прокрокований час — рівно від появи до останнього кроку, без часу до появи і без пропусків
+                time_conserved = time_conserved && std::abs(agent.stepped - (batch.last_step[i] - agent.spawned)) < tolerance;
+                on_schedule = on_schedule && frame - agent.last_frame < static_cast<int>(EnemySystem::LOD_BUCKET_COUNT);
+            }
+        }
+
+        // Кілька смертей і появ щокадру, нові — посеред інтервалу будь-якого кошика
+        for (int churn = static_cast<int>(gen() % 4); churn > 0 && !active.empty(); --churn) {
+            const size_t index = gen() % active.size();
+            system.unregister_entity(active[index]);
+            retired.push_back(active[index]);
+            active[index] = active.back();
+            active.pop_back();
+        }
+        while (!retired.empty() && gen() % 2 == 0) {
+            Entity *entity = retired.back();
+            retired.pop_back();
+            EnemyFactory::reset_enemy_entity(entity, random_type(), {x_dist(gen), y_dist(gen)});
+            spawn(entity);
+        }
+        for (size_t type = 0; type < ENEMY_TYPE_COUNT; ++type) {
+            consistent = consistent && groups_consistent(system.get_batch(static_cast<EnemyType>(type)));
+        }
+    }
+    consistent = consistent && system.get_enemy_count() == active.size();
+
+    const EnemySystem::LodCounts lods = system.get_lod_counts();
+    std::cout << "  " << lods.visible << " visible, " << lods.nearby << " nearby, " << lods.distant << " distant" << std::endl;
+    report("groups stay contiguous and batch_index matches the position", consistent);
+    report("every agent's summed step_time equals its elapsed clock", time_conserved);
+    report("every agent steps at least once per LOD_NEARBY_INTERVAL frames", on_schedule);
+    report("all three levels were exercised", lods.visible > 0 && lods.nearby > 0 && lods.distant > 0);
+}
+
+} // namespace
+
+int main() {
+    std::cout << "🎮 Testing batch kernels..." << std::endl;
+
+    check_steering_parity();
+    check_flow_field();
+    check_crowd_separation();
+    check_broadphase();
+    check_narrowphase();
+    check_sleep();
+    check_entity_pool();
+    check_enemy_lod();
+
+    std::cout << (failures == 0 ? "\n✅ All kernel checks passed" : "\n❌ Kernel checks failed") << std::endl;
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,253 @@
+// Компілятор перекладів: assets/lang/<code>.lang -> <code>.bloc
+//
+// Формат вхідного файлу — рядки "ключ = текст":
+//   # коментар
+//   health = HP
+//   survival_stats = You survived %.1f seconds\nand killed %d enemies
+// Пробіли навколо ключа й тексту обрізаються; підтримуються екранування \n, \t, \\.
+// Порожній текст означає "немає перекладу" — гра візьме вбудовану англійську.
+// Текст іде в snprintf як формат, тож аргументи printf у ньому мають бути ті самі й у тому ж порядку,
+// що й в еталонному файлі (en.lang) для того ж ключа; інакше каталог не компілюється.
+//
+// Використання: BulbykLocCompiler <input.lang> <output.bloc> [reference.lang]
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "core/LocalizationCatalog.h"
+
+using namespace LocalizationFormat;
+
+namespace {
+
+struct SourceEntry {
+  std::string key;
+  std::string text;
+  // Аргументи printf, які текст чекає при форматуванні
+  std::string arguments;
+  std::uint32_t hash;
+  int line;
+};
+
+std::string_view trim(std::string_view text) {
+  const auto first = text.find_first_not_of(" \t\r");
+  if (first == std::string_view::npos) {
+    return {};
+  }
+  const auto last = text.find_last_not_of(" \t\r");
+  return text.substr(first, last - first + 1);
+}
+
+bool is_valid_key(const std::string_view key) {
+  return !key.empty() && std::ranges::all_of(key, [](const char c) {
+    return (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_' || c == '.';
+  });
+}
+
+bool unescape(const std::string_view text, std::string *out) {
+  out->clear();
+  for (size_t i = 0; i < text.size(); ++i) {
+    if (text[i] != '\\') {
+      out->push_back(text[i]);
+      continue;
+    }
+    if (++i == text.size()) {
+      return false;
+    }
+    switch (text[i]) {
+      case 'n': out->push_back('\n'); break;
+      case 't': out->push_back('\t'); break;
+      case '\\': out->push_back('\\'); break;
+      default: return false;
+    }
+  }
+  return true;
+}
+
+// Послідовність аргументів printf: довжина і перетворення кожного, '*' — окремий int.
+// Прапорці, ширина й точність можуть різнитися між мовами, типи аргументів — ні. %n і позиційні не приймаються
+bool format_arguments(const std::string_view text, std::string *out) {
+  constexpr std::string_view flags = "-+ #0";
+  constexpr std::string_view lengths = "hlLjzt";
+  constexpr std::string_view conversions = "diouxXeEfFgGaAcsp";
+  const auto is_one_of = [&text](const size_t i, const std::string_view set) {
+    return i < text.size() && set.find(text[i]) != std::string_view::npos;
+  };
+  const auto skip_count = [&text, out](size_t &i) {
+    if (i < text.size() && text[i] == '*') {
+      out->append("* ");
+      ++i;
+      return;
+    }
+    while (i < text.size() && std::isdigit(static_cast<unsigned char>(text[i]))) {
+      ++i;
+    }
+  };
+
+  out->clear();
+  for (size_t i = 0; i < text.size(); ++i) {
+    if (text[i] != '%') {
+      continue;
+    }
+    if (++i < text.size() && text[i] == '%') {
+      continue;
+    }
+    while (is_one_of(i, flags)) {
+      ++i;
+    }
+    skip_count(i);
+    if (i < text.size() && text[i] == '.') {
+      skip_count(++i);
+    }
+    const size_t length = i;
+    while (is_one_of(i, lengths)) {
+      ++i;
+    }
+    if (!is_one_of(i, conversions)) {
+      return false;
+    }
+    out->append(text.substr(length, i + 1 - length)).push_back(' ');
+  }
+  return true;
+}
+
+bool parse_source(const std::string &path, std::vector<SourceEntry> *entries) {
+  std::ifstream input(path);
+  if (!input) {
+    std::cerr << path << ": can't open file" << std::endl;
+    return false;
+  }
+
+  bool ok = true;
+  std::unordered_map<std::uint32_t, size_t> by_hash;
+  std::string line;
+  for (int line_number = 1; std::getline(input, line); ++line_number) {
+    const std::string_view content = trim(line);
+    if (content.empty() || content.front() == '#') {
+      continue;
+    }
+
+    const auto separator = content.find('=');
+    if (separator == std::string_view::npos) {
+      std::cerr << path << ":" << line_number << ": expected 'key = text'" << std::endl;
+      ok = false;
+      continue;
+    }
+
+    const std::string_view key = trim(content.substr(0, separator));
+    if (!is_valid_key(key)) {
+      std::cerr << path << ":" << line_number << ": invalid key '" << key << "'" << std::endl;
+      ok = false;
+      continue;
+    }
+
+    SourceEntry entry{std::string(key), {}, {}, hash_key(key), line_number};
+    if (!unescape(trim(content.substr(separator + 1)), &entry.text)) {
+      std::cerr << path << ":" << line_number << ": bad escape sequence" << std::endl;
+      ok = false;
+      continue;
+    }
+    if (!format_arguments(entry.text, &entry.arguments)) {
+      std::cerr << path << ":" << line_number << ": bad printf conversion" << std::endl;
+      ok = false;
+      continue;
+    }
+
+    if (const auto it = by_hash.find(entry.hash); it != by_hash.end()) {
+      const SourceEntry &other = (*entries)[it->second];
+      std::cerr << path << ":" << line_number << ": key '" << key << "' "
+                << (other.key == entry.key ? "is already defined" : "has hash collision with '" + other.key + "'")
+                << " at line " << other.line << std::endl;
+      ok = false;
+      continue;
+    }
+
+    by_hash.emplace(entry.hash, entries->size());
+    entries->push_back(std::move(entry));
+  }
+  return ok;
+}
+
+// Переклад з іншими аргументами printf, ніж в еталоні, — невизначена поведінка в snprintf
+bool check_arguments(const std::string &path, const std::vector<SourceEntry> &entries,
+                     const std::string &reference_path, const std::vector<SourceEntry> &reference) {
+  std::unordered_map<std::uint32_t, const SourceEntry*> by_hash;
+  for (const SourceEntry &entry : reference) {
+    by_hash.emplace(entry.hash, &entry);
+  }
+
+  bool ok = true;
+  for (const SourceEntry &entry : entries) {
+    const auto it = by_hash.find(entry.hash);
+    if (entry.text.empty() || it == by_hash.end() || entry.arguments == it->second->arguments) {
+      continue;
+    }
+    std::cerr << path << ":" << entry.line << ": printf arguments of '" << entry.key << "' differ from "
+              << reference_path << ":" << it->second->line << std::endl;
+    ok = false;
+  }
+  return ok;
+}
+
+bool write_catalog(const std::string &path, std::vector<SourceEntry> entries) {
+  // Порожні переклади не потрапляють у каталог — рантайм падає на вбудований фолбек
+  std::erase_if(entries, [](const SourceEntry &entry) { return entry.text.empty(); });
+  std::ranges::sort(entries, {}, &SourceEntry::hash);
+
+  std::vector<CatalogEntry> table;
+  table.reserve(entries.size());
+  std::string blob;
+  for (const SourceEntry &entry : entries) {
+    table.push_back({entry.hash, static_cast<std::uint32_t>(blob.size()), static_cast<std::uint32_t>(entry.text.size())});
+    blob.append(entry.text);
+    blob.push_back('\0');
+  }
+
+  CatalogHeader header{};
+  std::copy_n(MAGIC, sizeof(MAGIC), header.magic);
+  header.version = VERSION;
+  header.entry_count = static_cast<std::uint32_t>(table.size());
+  header.blob_size = static_cast<std::uint32_t>(blob.size());
+
+  std::ofstream output(path, std::ios::binary | std::ios::trunc);
+  if (!output) {
+    std::cerr << path << ": can't create file" << std::endl;
+    return false;
+  }
+  output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  output.write(reinterpret_cast<const char*>(table.data()), static_cast<std::streamsize>(table.size() * sizeof(CatalogEntry)));
+  output.write(blob.data(), static_cast<std::streamsize>(blob.size()));
+  return static_cast<bool>(output);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  if (argc != 3 && argc != 4) {
+    std::cerr << "Usage: " << argv[0] << " <input.lang> <output.bloc> [reference.lang]" << std::endl;
+    return 2;
+  }
+
+  std::vector<SourceEntry> entries;
+  if (!parse_source(argv[1], &entries)) {
+    return 1;
+  }
+  if (argc == 4) {
+    std::vector<SourceEntry> reference;
+    if (!parse_source(argv[3], &reference) || !check_arguments(argv[1], entries, argv[3], reference)) {
+      return 1;
+    }
+  }
+  if (!write_catalog(argv[2], std::move(entries))) {
+    return 1;
+  }
+
+  std::cout << "Compiled " << argv[1] << " -> " << argv[2] << std::endl;
+  return 0;
+}